@@ -17,13 +17,19 @@ UTIL_DIR = $$SOURCEDIR/util
 WRL_DIR  = $$SOURCEDIR/wrl
 
 SOURCES += \
+	$$SOURCEDIR/core/ConcurrentPartition.cpp \
+	$$SOURCEDIR/core/EditableMesh.cpp \
 	$$SOURCEDIR/core/Edges.cpp \
 	$$SOURCEDIR/core/Faces.cpp \
 	$$SOURCEDIR/core/Graph.cpp \
 	$$SOURCEDIR/core/HalfEdges.cpp \
+	$$SOURCEDIR/core/MeshComponents.cpp \
+	$$SOURCEDIR/core/DualGraph.cpp \
+	$$SOURCEDIR/core/MeshTopologySummary.cpp \
 	$$SOURCEDIR/core/Partition.cpp \
 	$$SOURCEDIR/core/PolygonMesh.cpp \
 	$$SOURCEDIR/core/PolygonMeshTest.cpp \
+	$$SOURCEDIR/core/StreamingTopologySummary.cpp \
 #
 	$$SOURCEDIR/gui/GuiAboutDialog.cpp \
 	$$SOURCEDIR/gui/GuiGLBuffer.cpp \
@@ -41,6 +47,7 @@ SOURCES += \
 	$$SOURCEDIR/io/LoaderPly.cpp \
 	$$SOURCEDIR/io/LoaderStl.cpp \
 	$$SOURCEDIR/io/LoaderWrl.cpp \
+	$$SOURCEDIR/io/MappedPly.cpp \
 	$$SOURCEDIR/io/SaverPly.cpp \
 	$$SOURCEDIR/io/SaverStl.cpp \
 	$$SOURCEDIR/io/SaverWrl.cpp \
@@ -50,6 +57,8 @@ SOURCES += \
 #
 	$$SOURCEDIR/util/BBox.cpp \
 	$$SOURCEDIR/util/Endian.cpp \
+	$$SOURCEDIR/util/MappedFile.cpp \
+	$$SOURCEDIR/util/Parallel.cpp \
 	$$SOURCEDIR/util/StaticRotation.cpp \
 #
 	$$SOURCEDIR/wrl/Ply.cpp \
@@ -72,13 +81,20 @@ SOURCES += \
         $$(NULL)
 
 HEADERS += \
+	$$SOURCEDIR/core/ConcurrentPartition.hpp \
+	$$SOURCEDIR/core/EditableMesh.hpp \
 	$$SOURCEDIR/core/Edges.hpp \
 	$$SOURCEDIR/core/Faces.hpp \
 	$$SOURCEDIR/core/Graph.hpp \
 	$$SOURCEDIR/core/HalfEdges.hpp \
+	$$SOURCEDIR/core/IndexTraits.hpp \
+	$$SOURCEDIR/core/MeshComponents.hpp \
+	$$SOURCEDIR/core/DualGraph.hpp \
+	$$SOURCEDIR/core/MeshTopologySummary.hpp \
 	$$SOURCEDIR/core/Partition.hpp \
 	$$SOURCEDIR/core/PolygonMesh.hpp \
 	$$SOURCEDIR/core/PolygonMeshTest.hpp \
+	$$SOURCEDIR/core/StreamingTopologySummary.hpp \
 #
 	$$SOURCEDIR/gui/GuiAboutDialog.hpp \
 	$$SOURCEDIR/gui/GuiGLBuffer.hpp \
@@ -97,6 +113,7 @@ HEADERS += \
 	$$SOURCEDIR/io/LoaderPly.hpp \
 	$$SOURCEDIR/io/LoaderStl.hpp \
 	$$SOURCEDIR/io/LoaderWrl.hpp \
+	$$SOURCEDIR/io/MappedPly.hpp \
 	$$SOURCEDIR/io/Saver.hpp \
 	$$SOURCEDIR/io/SaverPly.hpp \
 	$$SOURCEDIR/io/SaverStl.hpp \
@@ -109,6 +126,8 @@ HEADERS += \
 	$$SOURCEDIR/util/CastMacros.hpp \
 	$$SOURCEDIR/util/BBox.hpp \
 	$$SOURCEDIR/util/Endian.hpp \
+	$$SOURCEDIR/util/MappedFile.hpp \
+	$$SOURCEDIR/util/Parallel.hpp \
 	$$SOURCEDIR/util/StaticRotation.hpp \
 #
 	$$SOURCEDIR/wrl/Ply.hpp \
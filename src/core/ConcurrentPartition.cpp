@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// ConcurrentPartition.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "ConcurrentPartition.hpp"
+#include "IndexTraits.hpp"
+
+template<class T>
+ConcurrentPartitionT<T>::ConcurrentPartitionT(const T nElements):
+  _nParts(0),
+  _parent()
+{
+  reset(nElements);
+}
+
+template<class T>
+void ConcurrentPartitionT<T>::reset(const T nElements) {
+  const T n = (nElements>0)?nElements:0;
+  // std::atomic is neither copyable nor movable, so the vector is
+  // rebuilt instead of resized
+  std::vector<std::atomic<T>> parent(n);
+  for(T i=0;i<n;i++)
+    parent[i].store(i,std::memory_order_relaxed);
+  _parent.swap(parent);
+  _nParts = n;
+}
+
+template<class T>
+T ConcurrentPartitionT<T>::getNumberOfElements() const {
+  return static_cast<T>(_parent.size());
+}
+
+template<class T>
+T ConcurrentPartitionT<T>::getNumberOfParts() const {
+  return _nParts;
+}
+
+template<class T>
+T ConcurrentPartitionT<T>::find(T i) {
+  if(!IndexTraits<T>::inRange(i,getNumberOfElements())) return IndexTraits<T>::none;
+  // path halving: every other node of the path is made to point to
+  // its grandparent; a failed CAS only means that another thread has
+  // already changed the link, and can be ignored
+  T Pi = _parent[i].load(std::memory_order_acquire);
+  while(Pi!=i) {
+    T PPi = _parent[Pi].load(std::memory_order_acquire);
+    if(PPi!=Pi)
+      _parent[i].compare_exchange_weak(Pi,PPi,std::memory_order_acq_rel);
+    i  = PPi;
+    Pi = _parent[i].load(std::memory_order_acquire);
+  }
+  return i;
+}
+
+template<class T>
+T ConcurrentPartitionT<T>::join(const T i, const T j) {
+  const T n = getNumberOfElements();
+  if(!IndexTraits<T>::inRange(i,n) || !IndexTraits<T>::inRange(j,n))
+    return IndexTraits<T>::none;
+  for(;;) {
+    T Ri = find(i);
+    T Rj = find(j);
+    if(Ri==Rj) return Ri;
+    // link the larger root to the smaller one; the CAS fails if Rj
+    // stopped being a root after it was found, and then the two roots
+    // have to be found again
+    if(Ri>Rj) { T R=Ri; Ri=Rj; Rj=R; }
+    T expected = Rj;
+    if(_parent[Rj].compare_exchange_strong(expected,Ri,std::memory_order_acq_rel)) {
+      _nParts.fetch_sub(1,std::memory_order_relaxed);
+      return Ri;
+    }
+  }
+}
+
+template<class T>
+std::vector<T> ConcurrentPartitionT<T>::compactLabels() {
+  const T n = getNumberOfElements();
+  std::vector<T> label(n,IndexTraits<T>::none);
+  T nLabels = 0;
+  // the root of a part is its smallest element, so it is visited
+  // before any other element of the part
+  for(T i=0;i<n;i++) {
+    const T Ri = find(i);
+    label[i] = (Ri==i)?nLabels++:label[Ri];
+  }
+  return label;
+}
+
+template class ConcurrentPartitionT<int>;
+template class ConcurrentPartitionT<uint32_t>;
+template class ConcurrentPartitionT<int64_t>;
@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// ConcurrentPartition.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef _CONCURRENT_PARTITION_HPP_
+#define _CONCURRENT_PARTITION_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+template<class T>
+class ConcurrentPartitionT {
+
+  // this class implements a lock-free version of the Union-Find data
+  // structure implemented by the Partition class; find() and join()
+  // can be called concurrently from multiple threads; T is the index
+  // type (see IndexTraits.hpp), and the values returned as -1 below
+  // are IndexTraits<T>::none
+  //
+  // - the parent links are updated with compare-and-swap operations
+  // - find() shortens the paths by path halving
+  // - join() always links the root with the larger index to the root
+  //   with the smaller index, so that the root of every part is its
+  //   smallest element, independently of the order in which the join
+  //   operations are executed
+  //
+  // Reference
+  // https://en.wikipedia.org/wiki/Disjoint-set_data_structure
+  
+public:
+
+  // create a partition of the N elements {0,1,2,...,N-1} where
+  // every element is a singleton {0},{1},{2},...,{N-1}
+  explicit ConcurrentPartitionT(T nElements);
+
+  // delete the current partition and create a new partition of the N
+  // elements {0,1,2,...,N-1} where every element is a singleton; this
+  // method must not be called concurrently with any other method
+  void reset(T nElements);
+
+  // returns the current number of elements
+  T getNumberOfElements() const;
+
+  // returns the current number of parts; it is exact once all the
+  // concurrent join operations have returned
+  T getNumberOfParts() const;
+
+  // returns the part ID number of the part containing element i, which
+  // is the smallest element of the part once all the concurrent join
+  // operations have returned; if the element index is out of range
+  // this method returns -1
+  T find(T i);
+
+  // joins the parts containing the elements i and j, and returns the
+  // ID of the joined part; if either one of the two element indices is
+  // out of range this method returns -1
+  T join(T i, T j);
+
+  // - returns an array of size getNumberOfElements() which assigns
+  //   each element a part label in the range 0<=label<getNumberOfParts();
+  //   the parts are labeled in increasing order of their smallest
+  //   element, so the result does not depend on how the join
+  //   operations were scheduled
+  // - this method must not be called concurrently with join()
+  std::vector<T> compactLabels();
+
+private:
+
+  std::atomic<T>              _nParts;
+  std::vector<std::atomic<T>> _parent;
+
+};
+
+extern template class ConcurrentPartitionT<int>;
+extern template class ConcurrentPartitionT<uint32_t>;
+extern template class ConcurrentPartitionT<int64_t>;
+
+using ConcurrentPartition = ConcurrentPartitionT<int>;
+
+#endif /* _CONCURRENT_PARTITION_HPP_ */
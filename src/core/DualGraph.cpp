@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// DualGraph.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "DualGraph.hpp"
+
+#include <util/Parallel.hpp>
+
+#include "HalfEdges.hpp"
+#include "IndexTraits.hpp"
+
+template<class T>
+DualGraphT<T>::DualGraphT():
+  _singular(CLIQUE),
+  _nF(0),
+  _faceFirstLink(),
+  _linkFace(),
+  _linkEdge(),
+  _linkCorner() {
+}
+
+template<class T>
+void DualGraphT<T>::build(const HalfEdgesT<T>& mesh, const SingularEdges singular) {
+  constexpr T none = IndexTraits<T>::none;
+  _singular = singular;
+  _nF       = mesh.getNumberOfFaces();
+
+  // visit(iF,fn) calls fn(iC,iE,iC1) for each corner iC of iF and
+  // each other half edge iC1 linked through the edge iE of iC
+  auto visit = [&](const T iF, auto&& fn) {
+    const T iC0 = mesh.getFaceFirstCorner(iF);
+    const T nC  = mesh.getFaceSize(iF);
+    for(T iC=iC0;iC<iC0+nC;iC++) {
+      const T iCt = mesh.getTwin(iC);
+      if(iCt!=none) {
+        fn(iC,mesh.getEdge(mesh.getSrc(iC),mesh.getDst(iC)),iCt);
+        continue;
+      }
+      if(singular==SKIP) continue;
+      const T iE = mesh.getEdge(mesh.getSrc(iC),mesh.getDst(iC));
+      if(mesh.getNumberOfEdgeHalfEdges(iE)<=2) continue; // boundary
+      for(const T iC1 : mesh.getEdgeHalfEdges(iE))
+        if(iC1!=iC) fn(iC,iE,iC1);
+    }
+  };
+
+  // 1) count the links of each face; the edges are only looked up for
+  //    the corners without a twin, to tell boundary edges from
+  //    singular ones
+  _faceFirstLink.assign(static_cast<size_t>(_nF)+1,0);
+  Parallel::forChunks(_nF,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t i=begin;i<end;i++) {
+      const T iF = static_cast<T>(i);
+      const T iC0 = mesh.getFaceFirstCorner(iF);
+      const T nC  = mesh.getFaceSize(iF);
+      T degree = 0;
+      for(T iC=iC0;iC<iC0+nC;iC++) {
+        if(mesh.getTwin(iC)!=none) {
+          degree++;
+        } else if(singular==CLIQUE) {
+          const T n = mesh.getNumberOfEdgeHalfEdges(mesh.getEdge(mesh.getSrc(iC),mesh.getDst(iC)));
+          if(n>2) degree += n-1;
+        }
+      }
+      _faceFirstLink[iF+1] = degree;
+    }
+  });
+  for(T iF=0;iF<_nF;iF++)
+    _faceFirstLink[iF+1] += _faceFirstLink[iF];
+
+  // 2) fill the rows; each face only writes its own row
+  const T nL = _faceFirstLink[_nF];
+  _linkFace.resize(nL);
+  _linkEdge.resize(nL);
+  _linkCorner.resize(nL);
+  Parallel::forChunks(_nF,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t i=begin;i<end;i++) {
+      const T iF = static_cast<T>(i);
+      T j = _faceFirstLink[iF];
+      visit(iF,[&](const T iC, const T iE, const T iC1) {
+        _linkFace[j]   = mesh.getFace(iC1);
+        _linkEdge[j]   = iE;
+        _linkCorner[j] = iC;
+        j++;
+      });
+    }
+  });
+}
+
+template<class T>
+T DualGraphT<T>::getNumberOfLinks() const {
+  return (_faceFirstLink.empty())?0:_faceFirstLink[_nF]/2;
+}
+
+template<class T>
+T DualGraphT<T>::getDegree(const T iF) const {
+  if(!IndexTraits<T>::inRange(iF,_nF)) return 0;
+  return _faceFirstLink[iF+1]-_faceFirstLink[iF];
+}
+
+template<class T>
+std::span<const T> DualGraphT<T>::getNeighbors(const T iF) const {
+  if(!IndexTraits<T>::inRange(iF,_nF)) return {};
+  return {_linkFace.data()+_faceFirstLink[iF],static_cast<size_t>(getDegree(iF))};
+}
+
+template<class T>
+std::span<const T> DualGraphT<T>::getNeighborEdges(const T iF) const {
+  if(!IndexTraits<T>::inRange(iF,_nF)) return {};
+  return {_linkEdge.data()+_faceFirstLink[iF],static_cast<size_t>(getDegree(iF))};
+}
+
+template<class T>
+std::span<const T> DualGraphT<T>::getNeighborCorners(const T iF) const {
+  if(!IndexTraits<T>::inRange(iF,_nF)) return {};
+  return {_linkCorner.data()+_faceFirstLink[iF],static_cast<size_t>(getDegree(iF))};
+}
+
+template class DualGraphT<int>;
+template class DualGraphT<uint32_t>;
+template class DualGraphT<int64_t>;
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// DualGraph.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef _DUAL_GRAPH_HPP_
+#define _DUAL_GRAPH_HPP_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+template<class T> class HalfEdgesT;
+
+template<class T>
+class DualGraphT {
+
+  // this class builds the dual graph of the faces of a mesh: the
+  // faces are the nodes, and two faces are linked once for every edge
+  // of the mesh they share
+  //
+  // - the links of each face are stored as CSR arrays, together with
+  //   the primal edge and the corner of the face on that edge; they
+  //   are listed in the order of the corners of the face
+  // - a regular edge links the faces of its two half edges; boundary
+  //   edges are not links
+  // - a singular edge, with n>2 incident half edges, links the faces
+  //   of every pair of them, i.e. it becomes a clique of n faces,
+  //   which are listed in the order of getEdgeHalfEdges(iE); with
+  //   SKIP singular edges are not links
+  // - two faces which share more than one edge are linked once per
+  //   edge, and a face which uses the same edge twice is linked to
+  //   itself
+  // - the rows are counted and then filled in two parallel passes over
+  //   the faces, with no synchronization, so the result does not
+  //   depend on the number of threads
+  // - T is the index type (see IndexTraits.hpp), and the values
+  //   returned as -1 below are IndexTraits<T>::none
+
+public:
+
+  enum SingularEdges {
+    CLIQUE = 0,
+    SKIP
+  };
+
+  DualGraphT();
+
+  // builds the dual graph of the faces of the mesh
+  void build(const HalfEdgesT<T>& mesh, SingularEdges singular=CLIQUE);
+
+  SingularEdges getSingularEdges() const { return _singular; }
+
+  T getNumberOfFaces() const { return _nF; }
+
+  // number of links, each one counted once; it is half the sum of the
+  // degrees of the faces
+  T getNumberOfLinks() const;
+
+  // number of links of face iF, which is the size of the spans below;
+  // 0 if iF is out of range
+  T getDegree(T iF) const;
+
+  // faces linked to iF; the spans are empty if iF is out of range
+  std::span<const T> getNeighbors(T iF) const;
+
+  // primal edges of the links of iF, in the same order as
+  // getNeighbors(iF)
+  std::span<const T> getNeighborEdges(T iF) const;
+
+  // corners of iF on the primal edges of its links, in the same order
+  // as getNeighbors(iF); the half edge of the corner is incident to
+  // the edge getNeighborEdges(iF)[j]
+  std::span<const T> getNeighborCorners(T iF) const;
+
+private:
+
+  SingularEdges  _singular;
+  T              _nF;
+
+  // CSR lists of the links of each face
+  std::vector<T> _faceFirstLink;
+  std::vector<T> _linkFace;
+  std::vector<T> _linkEdge;
+  std::vector<T> _linkCorner;
+};
+
+extern template class DualGraphT<int>;
+extern template class DualGraphT<uint32_t>;
+extern template class DualGraphT<int64_t>;
+
+using DualGraph = DualGraphT<int>;
+
+#endif // _DUAL_GRAPH_HPP_
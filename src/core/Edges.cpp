@@ -41,83 +41,415 @@
 
 #include "Edges.hpp"
 
+#include <algorithm>
+
+#include <util/Parallel.hpp>
+
+namespace {
+
+  // finalizer of MurmurHash3; spreads the bits of the packed
+  // (iV0,iV1) keys, which are highly structured, over the whole word
+  inline uint64_t mixKey(uint64_t key) {
+    key ^= key>>33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key>>33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key>>33;
+    return key;
+  }
+
+  inline uint64_t mixKey(const std::pair<uint64_t,uint64_t>& key) {
+    return mixKey(key.first^mixKey(key.second));
+  }
+
+}
+
 // public methods
 
-Edges::Edges(const int nV):
+template<class T>
+EdgesT<T>::EdgesT(const T nV, const Index index):
+  _index(index),
+  _nV(0),
+  _edge(),
   _first(),
-  _edge() {
+  _next(),
+  _hashKey(),
+  _hashEdge(),
+  _hashSize(0),
+  _rowFirst(),
+  _rowVertex1(),
+  _rowEdge(),
+  _nSorted(0) {
   reset(nV);
 }
 
-int Edges::getNumberOfVertices() const {
-  return static_cast<int>(_first.size());
+template<class T>
+typename EdgesT<T>::Index EdgesT<T>::getIndex() const {
+  return _index;
+}
+
+template<class T>
+T EdgesT<T>::getNumberOfVertices() const {
+  return _nV;
 }
 
-// the _edge array contains a triple (iV0,iV1,next) for inserted edge
-int Edges::getNumberOfEdges() const {
-  return static_cast<int>(_edge.size()/3);
+// the _edge array contains a pair (iV0,iV1) for inserted edge
+template<class T>
+T EdgesT<T>::getNumberOfEdges() const {
+  return static_cast<T>(_edge.size()/2);
 }
 
-int Edges::getEdge(int iV0, int iV1) const {
+template<class T>
+T EdgesT<T>::getEdge(T iV0, T iV1) const {
+  constexpr T none = IndexTraits<T>::none;
   // edges with the same ends are not allowed
-  if(iV0==iV1) return -1;
+  if(iV0==iV1) return none;
   // check that vertices are not out of range
-  int nV = getNumberOfVertices();
-  if(iV0<0 || nV<=iV0) return -1;
-  if(iV1<0 || nV<=iV1) return -1;
+  T nV = getNumberOfVertices();
+  if(!IndexTraits<T>::inRange(iV0,nV)) return none;
+  if(!IndexTraits<T>::inRange(iV1,nV)) return none;
   // make sure that iV0<iV1
-  if(iV0>iV1) { int iV=iV0; iV0=iV1; iV1=iV; }
-  // look for iV1 in the list of iV0
-  for(int j=_first[iV0];j>=0;j=/*next*/_edge[j+2])
-    if(/* _edge[j]==iV0 && */ _edge[j+1]==iV1)
-      // edge index is location of triple (iV0,iV1,next) in _edge
-      // array, regarded as an array of triples
-      return (j/3);
-  return -1;
+  if(iV0>iV1) std::swap(iV0,iV1);
+  switch(_index) {
+  case LINKED_LIST:
+    // look for iV1 in the list of iV0
+    for(T iE=_first[iV0];iE!=none;iE=_next[iE])
+      if(/* _edge[2*iE]==iV0 && */ _edge[2*iE+1]==iV1)
+        return iE;
+    return none;
+  case HASH:
+    return _hashFind(edgeKey(iV0,iV1));
+  case SORTED:
+    {
+      T iE = _sortedFind(iV0,iV1);
+      return (iE!=none)?iE:_hashFind(edgeKey(iV0,iV1));
+    }
+  }
+  return none;
 }
 
-int Edges::getVertex0(const int iE) const {
-  int nE = getNumberOfEdges();
-  if(iE<0 || iE>=nE) return -1;
-  return _edge[3*iE  ];
+template<class T>
+T EdgesT<T>::getVertex0(const T iE) const {
+  if(!IndexTraits<T>::inRange(iE,getNumberOfEdges())) return IndexTraits<T>::none;
+  return _edge[2*iE  ];
 }
 
-int Edges::getVertex1(const int iE) const {
-  int nE = getNumberOfEdges();
-  if(iE<0 || iE>=nE) return -1;
-  return _edge[3*iE+1];
+template<class T>
+T EdgesT<T>::getVertex1(const T iE) const {
+  if(!IndexTraits<T>::inRange(iE,getNumberOfEdges())) return IndexTraits<T>::none;
+  return _edge[2*iE+1];
 }
 
 // protected methods
 
-void Edges::reset(const int nV) {
+template<class T>
+void EdgesT<T>::reset(const T nV) {
+  _nV = (nV>0)?nV:0;
   _edge.clear();
   _first.clear();
-  for(int iV=0;iV<nV;iV++)
-    _first.push_back(-1);
+  _next.clear();
+  _hashKey.clear();
+  _hashEdge.clear();
+  _hashSize = 0;
+  _rowFirst.clear();
+  _rowVertex1.clear();
+  _rowEdge.clear();
+  _nSorted = 0;
+  if(_index==LINKED_LIST)
+    _first.assign(_nV,IndexTraits<T>::none);
+  else if(_index==SORTED)
+    _rowFirst.assign(static_cast<size_t>(_nV)+1,0);
 }
 
-int Edges::insertEdge(int iV0, int iV1) {
+template<class T>
+T EdgesT<T>::insertEdge(T iV0, T iV1) {
+  constexpr T none = IndexTraits<T>::none;
   // edges with the same ends are not allowed
-  if(iV0==iV1) return -1;
+  if(iV0==iV1) return none;
   // check that vertices are not out of range
-  int nV = getNumberOfVertices();
-  if(iV0<0 || nV<=iV0) return -1;
-  if(iV1<0 || nV<=iV1) return -1;
+  T nV = getNumberOfVertices();
+  if(!IndexTraits<T>::inRange(iV0,nV)) return none;
+  if(!IndexTraits<T>::inRange(iV1,nV)) return none;
   // make sure that iV0<iV1
-  if(iV0>iV1) { int iV=iV0; iV0=iV1; iV1=iV; }
+  if(iV0>iV1) std::swap(iV0,iV1);
   // if the edges has already been inserted, return the previously
   // assigned edge index
-  int iE = getEdge(iV0,iV1); if(iE>=0) return iE;
+  T iE = getEdge(iV0,iV1); if(iE!=none) return iE;
   // get the index of the next edge to be created
-  int j = static_cast<int>(_edge.size()); iE = j/3;
-  // append a new triple (iV0,iV1,*) to the _edge array 
-  // and link it to the list of iV0 as the first node
+  iE = getNumberOfEdges();
+  // append a new pair (iV0,iV1) to the _edge array
   _edge.push_back(iV0);
   _edge.push_back(iV1);
-  _edge.push_back(_first[iV0]);
-  // _first[iV0] ->  ... (.,.,-1)
-  _first[iV0] = j;
+  if(_index==LINKED_LIST) {
+    // link it to the list of iV0 as the first node
+    _next.push_back(_first[iV0]);
+    _first[iV0] = iE;
+  } else {
+    // SORTED keeps the edges inserted since the last bulk build in
+    // the hash table
+    _hashInsert(edgeKey(iV0,iV1),iE);
+  }
   // return the index of the new edge
   return iE;
 }
+
+template<class T>
+void EdgesT<T>::insertEdges(std::span<const std::pair<T,T>> vertexPairs,
+                            std::vector<T>* edgeIndex) {
+  constexpr T none = IndexTraits<T>::none;
+  const T       nV = getNumberOfVertices();
+  const int64_t n  = static_cast<int64_t>(vertexPairs.size());
+  if(edgeIndex!=nullptr) edgeIndex->resize(n);
+
+  // - the pairs are packed into keys of 2*vBits bits, which have to
+  //   fit in the 64 bit keys of the radix sort; otherwise insert them
+  //   one at a time
+  // - on a single thread the linked lists and the hash table are
+  //   faster to fill one pair at a time than by sorting
+  const uint64_t maxV = (nV>1)?static_cast<uint64_t>(nV-1):1;
+  int vBits = 1;
+  while(vBits<64 && (maxV>>vBits)!=0) vBits++;
+  if(vBits>32 || (_index!=SORTED && Parallel::getNumberOfThreads()==1)) {
+    for(int64_t i=0;i<n;i++) {
+      const T iE = insertEdge(vertexPairs[i].first,vertexPairs[i].second);
+      if(edgeIndex!=nullptr) (*edgeIndex)[i] = iE;
+    }
+    return;
+  }
+  const int      nBits   = 2*vBits;
+  const uint64_t vMask   = (uint64_t(1)<<vBits)-1;
+  // larger than the key of any valid pair, since those have iV0<iV1
+  const uint64_t invalid = (nBits<64)?(uint64_t(1)<<nBits)-1:~uint64_t(0);
+
+  // 1) pack each valid pair as (min,max), and sort the keys together
+  //    with the positions; the sort is stable, so each run of equal
+  //    keys starts with the first occurrence of the pair
+  std::vector<uint64_t> key(n);
+  std::vector<T>        pos(n);
+  Parallel::forChunks(n,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t i=begin;i<end;i++) {
+      const auto& [iV0,iV1] = vertexPairs[i];
+      if(iV0!=iV1 && IndexTraits<T>::inRange(iV0,nV) && IndexTraits<T>::inRange(iV1,nV))
+        key[i] = (static_cast<uint64_t>(std::min(iV0,iV1))<<vBits)|
+          static_cast<uint64_t>(std::max(iV0,iV1));
+      else
+        key[i] = invalid;
+      pos[i] = static_cast<T>(i);
+    }
+  });
+  Parallel::radixSort(key,pos,nBits);
+  auto isFirst = [&](const int64_t j) {
+    return key[j]!=invalid && (j==0 || key[j]!=key[j-1]);
+  };
+
+  // 2) look up the pair of each run among the existing edges;
+  //    runEdge and isNew are indexed by the position of the first
+  //    occurrence of the pair
+  const T nE0 = getNumberOfEdges();
+  std::vector<T>       runEdge(n,none);
+  std::vector<uint8_t> isNew(n,0);
+  Parallel::forChunks(n,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t j=begin;j<end;j++) {
+      if(!isFirst(j)) continue;
+      const T iE = (nE0==0)?none:
+        getEdge(static_cast<T>(key[j]>>vBits),static_cast<T>(key[j]&vMask));
+      if(iE!=none) runEdge[pos[j]] = iE;
+      else         isNew[pos[j]]   = 1;
+    }
+  });
+
+  // 3) number the new edges in order of first occurrence, which is
+  //    the order in which insertEdge() would have numbered them, with
+  //    a prefix sum of the per-chunk counts
+  std::vector<int64_t> chunkFirst(Parallel::getNumberOfChunks(n)+1,0);
+  Parallel::forChunks(n,[&](int iChunk, int64_t begin, int64_t end) {
+    int64_t count = 0;
+    for(int64_t i=begin;i<end;i++) count += isNew[i];
+    chunkFirst[iChunk+1] = count;
+  });
+  for(size_t k=1;k<chunkFirst.size();k++)
+    chunkFirst[k] += chunkFirst[k-1];
+  const T nE1 = nE0+static_cast<T>(chunkFirst.back());
+  _edge.resize(2*static_cast<size_t>(nE1));
+  Parallel::forChunks(n,[&](int iChunk, int64_t begin, int64_t end) {
+    T iE = nE0+static_cast<T>(chunkFirst[iChunk]);
+    for(int64_t i=begin;i<end;i++) {
+      if(!isNew[i]) continue;
+      const auto& [iV0,iV1] = vertexPairs[i];
+      _edge[2*static_cast<size_t>(iE)  ] = std::min(iV0,iV1);
+      _edge[2*static_cast<size_t>(iE)+1] = std::max(iV0,iV1);
+      runEdge[i] = iE++;
+    }
+  });
+
+  // 4) every occurrence gets the edge of its run; each chunk first
+  //    walks back to the start of the run it begins in
+  if(edgeIndex!=nullptr) {
+    Parallel::forChunks(n,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+      int64_t first = begin;
+      while(first>0 && key[first-1]==key[first]) first--;
+      for(int64_t j=begin;j<end;j++) {
+        if(key[j]!=key[first]) first = j;
+        (*edgeIndex)[pos[j]] = (key[j]!=invalid)?runEdge[pos[first]]:none;
+      }
+    });
+  }
+
+  // 5) add the new edges to the lookup table
+  switch(_index) {
+  case LINKED_LIST:
+    _next.resize(nE1);
+    for(T iE=nE0;iE<nE1;iE++) {
+      const T iV0 = _edge[2*iE];
+      _next[iE]   = _first[iV0];
+      _first[iV0] = iE;
+    }
+    break;
+  case HASH:
+    for(T iE=nE0;iE<nE1;iE++)
+      _hashInsert(edgeKey(_edge[2*iE],_edge[2*iE+1]),iE);
+    break;
+  case SORTED:
+    _buildSortedIndex();
+    break;
+  }
+}
+
+template<class T>
+void EdgesT<T>::loadEdges(std::span<const std::pair<T,T>> vertexPairs) {
+  reset(getNumberOfVertices());
+  const T nE = static_cast<T>(vertexPairs.size());
+  _edge.resize(2*static_cast<size_t>(nE));
+  for(T iE=0;iE<nE;iE++) {
+    _edge[2*iE  ] = vertexPairs[iE].first;
+    _edge[2*iE+1] = vertexPairs[iE].second;
+  }
+  switch(_index) {
+  case LINKED_LIST:
+    _next.resize(nE);
+    for(T iE=0;iE<nE;iE++) {
+      const T iV0 = _edge[2*iE];
+      _next[iE]   = _first[iV0];
+      _first[iV0] = iE;
+    }
+    break;
+  case HASH:
+    {
+      size_t size = 16;
+      while(size<2*static_cast<size_t>(nE)) size *= 2;
+      _hashKey.assign(size,_emptyKey);
+      _hashEdge.assign(size,IndexTraits<T>::none);
+      const size_t mask = size-1;
+      for(T iE=0;iE<nE;iE++) {
+        const Key key = edgeKey(_edge[2*iE],_edge[2*iE+1]);
+        size_t h = mixKey(key)&mask;
+        while(_hashKey[h]!=_emptyKey)
+          h = (h+1)&mask;
+        _hashKey[h]  = key;
+        _hashEdge[h] = iE;
+      }
+      _hashSize = nE;
+    }
+    break;
+  case SORTED:
+    _buildSortedIndex();
+    break;
+  }
+}
+
+// private methods
+
+template<class T>
+T EdgesT<T>::_hashFind(const Key& key) const {
+  if(_hashKey.empty()) return IndexTraits<T>::none;
+  const size_t mask = _hashKey.size()-1;
+  for(size_t h=mixKey(key)&mask;_hashKey[h]!=_emptyKey;h=(h+1)&mask)
+    if(_hashKey[h]==key)
+      return _hashEdge[h];
+  return IndexTraits<T>::none;
+}
+
+template<class T>
+void EdgesT<T>::_hashInsert(const Key& key, const T iE) {
+  // keep the load factor at most 1/2
+  if(2*(_hashSize+1)>_hashKey.size())
+    _hashGrow();
+  const size_t mask = _hashKey.size()-1;
+  size_t h = mixKey(key)&mask;
+  while(_hashKey[h]!=_emptyKey)
+    h = (h+1)&mask;
+  _hashKey[h]  = key;
+  _hashEdge[h] = iE;
+  _hashSize++;
+}
+
+template<class T>
+void EdgesT<T>::_hashGrow() {
+  std::vector<Key> oldKey;
+  std::vector<T>   oldEdge;
+  oldKey.swap(_hashKey);
+  oldEdge.swap(_hashEdge);
+  const size_t size = std::max<size_t>(16,2*oldKey.size());
+  _hashKey.assign(size,_emptyKey);
+  _hashEdge.assign(size,IndexTraits<T>::none);
+  const size_t mask = size-1;
+  for(size_t j=0;j<oldKey.size();j++) {
+    if(oldKey[j]==_emptyKey) continue;
+    size_t h = mixKey(oldKey[j])&mask;
+    while(_hashKey[h]!=_emptyKey)
+      h = (h+1)&mask;
+    _hashKey[h]  = oldKey[j];
+    _hashEdge[h] = oldEdge[j];
+  }
+}
+
+template<class T>
+T EdgesT<T>::_sortedFind(const T iV0, const T iV1) const {
+  // rows are empty until the first bulk build
+  const T* row    = _rowVertex1.data();
+  const T* rowBeg = row+_rowFirst[iV0];
+  const T* rowEnd = row+_rowFirst[iV0+1];
+  const T* it = std::lower_bound(rowBeg,rowEnd,iV1);
+  return (it!=rowEnd && *it==iV1)?_rowEdge[it-row]:IndexTraits<T>::none;
+}
+
+template<class T>
+void EdgesT<T>::_buildSortedIndex() {
+  const T nV = getNumberOfVertices();
+  const T nE = getNumberOfEdges();
+  // counting sort of the edges by iV0; within each row the edges end
+  // up in increasing edge index order
+  _rowFirst.assign(static_cast<size_t>(nV)+1,0);
+  for(T iE=0;iE<nE;iE++)
+    _rowFirst[_edge[2*iE]+1]++;
+  for(T iV=0;iV<nV;iV++)
+    _rowFirst[iV+1] += _rowFirst[iV];
+  // each entry packs (iV1,iE), so that sorting a row sorts it by iV1
+  // without looking back at the _edge array
+  std::vector<Key> row(nE);
+  std::vector<T> pos(_rowFirst.begin(),_rowFirst.end()-1);
+  for(T iE=0;iE<nE;iE++)
+    row[pos[_edge[2*iE]]++] = edgeKey(_edge[2*iE+1],iE);
+  // rows are as short as vertex valences, and are sorted in parallel
+  Parallel::forChunks(nV,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t iV=begin;iV<end;iV++)
+      std::sort(row.begin()+_rowFirst[iV],row.begin()+_rowFirst[iV+1]);
+  });
+  _rowVertex1.resize(nE);
+  _rowEdge.resize(nE);
+  Parallel::forChunks(nE,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t j=begin;j<end;j++) {
+      _rowVertex1[j] = IndexTraits<T>::keyHi(row[j]);
+      _rowEdge[j]    = IndexTraits<T>::keyLo(row[j]);
+    }
+  });
+  _nSorted = nE;
+  // every edge is now covered by the rows
+  _hashKey.clear();
+  _hashEdge.clear();
+  _hashSize = 0;
+}
+
+template class EdgesT<int>;
+template class EdgesT<uint32_t>;
+template class EdgesT<int64_t>;
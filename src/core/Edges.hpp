@@ -41,9 +41,15 @@
 
 #pragma once
 
+#include <cstdint>
+#include <span>
+#include <utility>
 #include <vector>
 
-class Edges {
+#include "IndexTraits.hpp"
+
+template<class T>
+class EdgesT {
 
   // - the public interface to the Edges class only allows read-only
   //   access
@@ -51,32 +57,60 @@ class Edges {
   //   created
   // - the Graph class is identical to the Edges class with the
   //   insertEdge method made public
+  // - T is the index type (see IndexTraits.hpp); the values returned
+  //   as -1 below are IndexTraits<T>::none
   
 public:
 
+  // - three interchangeable representations are provided for the
+  //   (iV0,iV1)->iE lookup table; all of them assign edge indices in
+  //   the order in which the edges are first inserted, so the results
+  //   of every public method are independent of the choice
+  // - LINKED_LIST : array of single-linked lists, one per vertex
+  // - HASH        : open-addressing hash table on packed
+  //                 (iV0,iV1) keys, with linear probing
+  // - SORTED      : CSR rows of sorted iV1 values, one row per iV0,
+  //                 built in bulk by insertEdges(); searched by
+  //                 bisection; edges inserted one at a time after the
+  //                 last bulk build are kept in the hash table until
+  //                 the next one
+  // - LINKED_LIST is the default; it is the fastest for meshes with
+  //   bounded vertex valences, while the other two keep lookups cheap
+  //   around high valence vertices (see dgpBench)
+  enum Index {
+    LINKED_LIST = 0,
+    HASH,
+    SORTED
+  };
+
+  using Key = typename IndexTraits<T>::Key;
+
   // create a graph with nV vertices and no edges;
   // the range of valid vertex indices is 0<=iV<nV
-  explicit Edges(int nV);
+  explicit EdgesT(T nV, Index index=LINKED_LIST);
+
+  // returns the representation used for the edge lookup table
+  Index getIndex() const;
 
   // returns the number of vertices
-  int getNumberOfVertices() const;
+  T getNumberOfVertices() const;
 
   // returns the number of edges nE at the time of the call;
   // at any particular time, the range of valid vertex indices is
   // 0<=iE<getNumberOfEdges()
-  int getNumberOfEdges() const;
+  T getNumberOfEdges() const;
 
   // returns -1 if iV0==iV1 or one of the vertex indices is out of
   // range; also returns -1 if the edge (iV0,iV1) has not been
   // inserted into the Edges yet; otherwise it returns the edge index iE
   // assigned to the edge when inserted
-  int getEdge(int iV0, int iV1) const;
+  T getEdge(T iV0, T iV1) const;
 
   // an edge is stored internally as a pair of vertex indices
   // (iV0,iV1) so that iV0<iV1; getVertex0(iE) returns iV0, and
   // getVertex1(iE) returns iV1.
-  int getVertex0(int iE) const;
-  int getVertex1(int iE) const;
+  T getVertex0(T iE) const;
+  T getVertex1(T iE) const;
 
   // Edges Traversal sample code
   //
@@ -90,8 +124,9 @@ public:
 
 protected:
 
-  // remove all the edges, and change the number of vertices
-  void reset(int nV);
+  // remove all the edges, and change the number of vertices; the
+  // representation of the lookup table is not changed
+  void reset(T nV);
 
   // - if iV0==iV1 or one of the two vertex indices is out of range,
   //   _insertEdge() returns -1 ;
@@ -99,20 +134,88 @@ protected:
   //   _insertEdge() returns iE;
   // - otherwise a new edge index iE is assigned to the edge, and
   //   insertEdge() returns the new index iE
-  int insertEdge(int iV0, int iV1);
+  T insertEdge(T iV0, T iV1);
+
+  // - equivalent to calling insertEdge(iV0,iV1) on every pair of the
+  //   span, in order; if edgeIndex is not null it is resized to the
+  //   size of the span and filled with the values that those calls
+  //   would have returned
+  // - the pairs are deduplicated in parallel with a radix sort of
+  //   their packed keys, the distinct ones are looked up concurrently,
+  //   and the new edges are added to the lookup table once at the
+  //   end; when it is SORTED they do not go through the hash table,
+  //   and the CSR rows are rebuilt once
+  // - on a single thread, except when the lookup table is SORTED, and
+  //   for 64 bit indices with more than 2^32 vertices, the pairs are
+  //   inserted one at a time
+  void insertEdges(std::span<const std::pair<T,T>> vertexPairs,
+                   std::vector<T>* edgeIndex=nullptr);
+
+  // - removes all the edges, and inserts the given pairs so that the
+  //   edge index assigned to vertexPairs[iE] is iE
+  // - the pairs must be valid, with iV0<iV1, and pairwise distinct;
+  //   since they are not looked up before being inserted this is
+  //   much faster than insertEdges() when they are known to be so
+  void loadEdges(std::span<const std::pair<T,T>> vertexPairs);
+
+  // packs an edge with iV0<iV1 into a single key which sorts in
+  // (iV0,iV1) lexicographic order
+  static Key edgeKey(T iV0, T iV1) {
+    return IndexTraits<T>::makeKey(iV0,iV1);
+  }
 
 private:
 
-  // representation: array of single-linked lists
-
-  // _first[iV0] is the index into _edge array corresponding to first
-  // edge (iV0,iV1) so that iV0<iV1; _first[iV0]==-1 if the list is
-  // empty
-  std::vector<int> _first;
-  // stores triples (iV0,iV1,next), where the next value is an index
-  // into _edge array corresponding to next edge (iV0,iV1) so that
-  // iV0<iV1; next==-1 indicates the end of the list; the order of the
-  // triples in each list is not specified
-  std::vector<int> _edge;
+  T    _hashFind(const Key& key) const;
+  void _hashInsert(const Key& key, T iE);
+  void _hashGrow();
+  T    _sortedFind(T iV0, T iV1) const;
+  void _buildSortedIndex();
+
+  Index _index;
+
+  T _nV;
+
+  // pairs (iV0,iV1) with iV0<iV1, one per edge, in edge index order;
+  // shared by all the representations
+  std::vector<T> _edge;
+
+  // LINKED_LIST representation: array of single-linked lists
+
+  // _first[iV0] is the index of the first edge (iV0,iV1) so that
+  // iV0<iV1; _first[iV0]==-1 if the list is empty
+  std::vector<T> _first;
+  // _next[iE] is the index of the next edge in the list of
+  // getVertex0(iE); -1 indicates the end of the list; the order of
+  // the edges in each list is not specified
+  std::vector<T> _next;
+
+  // HASH representation: open addressing with linear probing; the
+  // size of the table is a power of 2, and it is kept at most half
+  // full; empty slots have _hashKey[h]==_emptyKey, which packs the
+  // pair (-1,-1); the edge index of an occupied slot is stored in
+  // _hashEdge[h], which is only touched when the key matches
+
+  static constexpr Key _emptyKey =
+    IndexTraits<T>::makeKey(IndexTraits<T>::none,IndexTraits<T>::none);
+  std::vector<Key> _hashKey;
+  std::vector<T>   _hashEdge;
+  size_t _hashSize; // number of occupied slots
+
+  // SORTED representation: the iV1 values of the edges (iV0,iV1) are
+  // stored in _rowVertex1[_rowFirst[iV0]:_rowFirst[iV0+1]] in
+  // increasing order, and _rowEdge holds the matching edge indices;
+  // the first _nSorted edges are covered by the rows, and the
+  // remaining ones are looked up in the hash table
+  std::vector<T> _rowFirst;
+  std::vector<T> _rowVertex1;
+  std::vector<T> _rowEdge;
+  T _nSorted;
 
 };
+
+extern template class EdgesT<int>;
+extern template class EdgesT<uint32_t>;
+extern template class EdgesT<int64_t>;
+
+using Edges = EdgesT<int>;
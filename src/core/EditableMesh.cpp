@@ -0,0 +1,691 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// EditableMesh.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "EditableMesh.hpp"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+#include <wrl/IndexedFaceSet.hpp>
+
+#include "Graph.hpp"
+
+EditableMesh::EditableMesh():
+  _coord(),
+  _vertexHalfEdge(),
+  _vertexDeleted(),
+  _src(),
+  _next(),
+  _prev(),
+  _face(),
+  _faceHalfEdge(),
+  _freeVertex(),
+  _freeEdge(),
+  _freeFace(),
+  _nVertices(0),
+  _nEdges(0),
+  _nFaces(0),
+  _vertexStamp(),
+  _faceStamp(),
+  _stamp(0),
+  _ring() {
+}
+
+EditableMesh::EditableMesh(const std::vector<float>& coord,
+                           const std::vector<int>& coordIndex):
+  EditableMesh() {
+  build(coord,coordIndex);
+}
+
+EditableMesh::EditableMesh(IndexedFaceSet& ifs):
+  EditableMesh() {
+  build(ifs.getCoord(),ifs.getCoordIndex());
+}
+
+void EditableMesh::build(const std::vector<float>& coord,
+                         const std::vector<int>& coordIndex) {
+  try {
+    _build(coord,coordIndex);
+  } catch(...) {
+    *this = EditableMesh();
+    throw;
+  }
+}
+
+void EditableMesh::_build(const std::vector<float>& coord,
+                          const std::vector<int>& coordIndex) {
+
+  const int nV = static_cast<int>(coord.size()/3);
+  const int nC = static_cast<int>(coordIndex.size());
+
+  _coord.assign(coord.begin(),coord.begin()+3*nV);
+  _vertexHalfEdge.assign(nV,-1);
+  _vertexDeleted.assign(nV,false);
+  _src.clear();
+  _next.clear();
+  _prev.clear();
+  _face.clear();
+  _faceHalfEdge.clear();
+  _freeVertex.clear();
+  _freeEdge.clear();
+  _freeFace.clear();
+  _nVertices = nV;
+  _nEdges    = 0;
+  _nFaces    = 0;
+  _vertexStamp.assign(nV,0);
+  _faceStamp.clear();
+  _stamp     = 0;
+
+  // 1) create the half-edges of the faces; the edges are numbered in
+  //    the order in which they are first found, and the half-edge
+  //    2*iE goes from getVertex0(iE) to getVertex1(iE); the corners
+  //    after the last face separator, if any, are ignored
+  Graph graph(nV);
+  int iC0 = 0;
+  for(int iC=0;iC<nC;iC++) {
+    const int iV = coordIndex[iC];
+    if(iV<-1 || iV>=nV)
+      throw std::runtime_error(std::format("Unexpected coordIndex value {} at {} position.", iV, iC));
+    if(iV>=0) continue;
+
+    const int nCF = iC-iC0;
+    if(nCF<3)
+      throw std::runtime_error(std::format("Face ending at position {} has fewer than three corners.", iC));
+    const unsigned stamp = _nextStamp();
+    for(int iCF=iC0;iCF<iC;iCF++) {
+      if(_vertexStamp[coordIndex[iCF]]==stamp)
+        throw std::runtime_error(std::format("Face ending at position {} repeats vertex {}.", iC, coordIndex[iCF]));
+      _vertexStamp[coordIndex[iCF]] = stamp;
+    }
+
+    const int iF = _newFace();
+    int iH0 = -1, iHprev = -1;
+    for(int iCF=iC0;iCF<iC;iCF++) {
+      const int iV0 = coordIndex[iCF];
+      const int iV1 = coordIndex[(iCF+1<iC)?iCF+1:iC0];
+      const int iE  = graph.insertEdge(iV0,iV1);
+      if(iE==getEdgeRange()) _newEdge();
+      const int iH = 2*iE+((iV0<iV1)?0:1);
+      if(_src[iH]>=0)
+        throw std::runtime_error(std::format("Edge ({},{}) is shared by more than two faces, or by two faces with the same orientation.", iV0, iV1));
+      _src[iH]  = iV0;
+      _face[iH] = iF;
+      if(iHprev<0) iH0 = iH; else _link(iHprev,iH);
+      iHprev = iH;
+    }
+    _link(iHprev,iH0);
+    _faceHalfEdge[iF] = iH0;
+    iC0 = iC+1;
+  }
+
+  // 2) the half-edges not used by any face are boundary half-edges
+  const int nH = static_cast<int>(_src.size());
+  for(int iH=0;iH<nH;iH++)
+    if(_src[iH]<0)
+      _src[iH] = (iH&1)?graph.getVertex1(iH/2):graph.getVertex0(iH/2);
+
+  // 3) link each boundary half-edge to the next boundary half-edge
+  //    found rotating around its destination vertex; the rotation only
+  //    visits face half-edges, whose prev links are already set
+  for(int iH=0;iH<nH;iH++) {
+    if(_face[iH]>=0) continue;
+    int iG = iH^1;
+    while(_face[iG]>=0)
+      iG = _prev[iG]^1;
+    _link(iH,iG);
+  }
+
+  // 4) choose the outgoing half-edges, preferring boundary half-edges
+  for(int iH=0;iH<nH;iH++) {
+    const int iV = _src[iH];
+    if(_vertexHalfEdge[iV]<0 || _face[iH]<0)
+      _vertexHalfEdge[iV] = iH;
+  }
+
+  // 5) every outgoing half-edge must be reached by rotating around
+  //    its source; otherwise the faces incident to the vertex form
+  //    more than one fan
+  std::vector<int> nOut(nV,0);
+  for(int iH=0;iH<nH;iH++)
+    nOut[_src[iH]]++;
+  for(int iV=0;iV<nV;iV++)
+    if(nOut[iV]!=getValence(iV))
+      throw std::runtime_error(std::format("Vertex {} is singular.", iV));
+}
+
+void EditableMesh::exportMesh(std::vector<float>& coord,
+                              std::vector<int>& coordIndex) const {
+  const int nV = getVertexRange();
+  std::vector<int> vertexMap(nV,-1);
+  coord.clear();
+  coord.reserve(3*_nVertices);
+  int nVout = 0;
+  for(int iV=0;iV<nV;iV++) {
+    if(_vertexDeleted[iV]) continue;
+    vertexMap[iV] = nVout++;
+    coord.insert(coord.end(),_coord.begin()+3*iV,_coord.begin()+3*iV+3);
+  }
+  coordIndex.clear();
+  coordIndex.reserve(2*_nEdges+_nFaces);
+  const int nF = getFaceRange();
+  for(int iF=0;iF<nF;iF++) {
+    const int iH0 = _faceHalfEdge[iF];
+    if(iH0<0) continue;
+    int iH = iH0;
+    do {
+      coordIndex.push_back(vertexMap[_src[iH]]);
+      iH = _next[iH];
+    } while(iH!=iH0);
+    coordIndex.push_back(-1);
+  }
+}
+
+void EditableMesh::exportMesh(IndexedFaceSet& ifs) const {
+  exportMesh(ifs.getCoord(),ifs.getCoordIndex());
+  ifs.getNormal().clear();
+  ifs.getNormalIndex().clear();
+  ifs.getColor().clear();
+  ifs.getColorIndex().clear();
+  ifs.getTexCoord().clear();
+  ifs.getTexCoordIndex().clear();
+}
+
+int EditableMesh::getNumberOfVertices() const {
+  return _nVertices;
+}
+
+int EditableMesh::getNumberOfEdges() const {
+  return _nEdges;
+}
+
+int EditableMesh::getNumberOfFaces() const {
+  return _nFaces;
+}
+
+int EditableMesh::getVertexRange() const {
+  return static_cast<int>(_vertexHalfEdge.size());
+}
+
+int EditableMesh::getEdgeRange() const {
+  return static_cast<int>(_src.size()/2);
+}
+
+int EditableMesh::getFaceRange() const {
+  return static_cast<int>(_faceHalfEdge.size());
+}
+
+bool EditableMesh::isVertex(const int iV) const {
+  return 0<=iV && iV<getVertexRange() && !_vertexDeleted[iV];
+}
+
+bool EditableMesh::isEdge(const int iE) const {
+  return 0<=iE && iE<getEdgeRange() && _src[2*iE]>=0;
+}
+
+bool EditableMesh::isFace(const int iF) const {
+  return 0<=iF && iF<getFaceRange() && _faceHalfEdge[iF]>=0;
+}
+
+bool EditableMesh::isHalfEdge(const int iH) const {
+  return 0<=iH && iH<static_cast<int>(_src.size()) && _src[iH]>=0;
+}
+
+const float* EditableMesh::getCoord(const int iV) const {
+  return isVertex(iV)?&_coord[3*iV]:nullptr;
+}
+
+void EditableMesh::setCoord(const int iV, const float x, const float y, const float z) {
+  if(!isVertex(iV)) return;
+  _coord[3*iV  ] = x;
+  _coord[3*iV+1] = y;
+  _coord[3*iV+2] = z;
+}
+
+int EditableMesh::getSrc(const int iH) const {
+  return isHalfEdge(iH)?_src[iH]:-1;
+}
+
+int EditableMesh::getDst(const int iH) const {
+  return isHalfEdge(iH)?_src[iH^1]:-1;
+}
+
+int EditableMesh::getNext(const int iH) const {
+  return isHalfEdge(iH)?_next[iH]:-1;
+}
+
+int EditableMesh::getPrev(const int iH) const {
+  return isHalfEdge(iH)?_prev[iH]:-1;
+}
+
+int EditableMesh::getTwin(const int iH) const {
+  return isHalfEdge(iH)?(iH^1):-1;
+}
+
+int EditableMesh::getFace(const int iH) const {
+  return isHalfEdge(iH)?_face[iH]:-1;
+}
+
+int EditableMesh::getEdge(const int iH) const {
+  return isHalfEdge(iH)?iH/2:-1;
+}
+
+int EditableMesh::getEdgeHalfEdge(const int iE, const int j) const {
+  return (isEdge(iE) && (j==0 || j==1))?2*iE+j:-1;
+}
+
+int EditableMesh::getEdge(const int iV0, const int iV1) const {
+  if(!isVertex(iV0) || !isVertex(iV1) || iV0==iV1) return -1;
+  const int iH0 = _vertexHalfEdge[iV0];
+  if(iH0<0) return -1;
+  int iH = iH0;
+  do {
+    if(_src[iH^1]==iV1) return iH/2;
+    iH = _prev[iH]^1;
+  } while(iH!=iH0);
+  return -1;
+}
+
+int EditableMesh::getVertexHalfEdge(const int iV) const {
+  return isVertex(iV)?_vertexHalfEdge[iV]:-1;
+}
+
+int EditableMesh::getFaceHalfEdge(const int iF) const {
+  return isFace(iF)?_faceHalfEdge[iF]:-1;
+}
+
+int EditableMesh::getFaceSize(const int iF) const {
+  if(!isFace(iF)) return 0;
+  const int iH0 = _faceHalfEdge[iF];
+  int n = 0, iH = iH0;
+  do { n++; iH = _next[iH]; } while(iH!=iH0);
+  return n;
+}
+
+int EditableMesh::getValence(const int iV) const {
+  if(!isVertex(iV)) return 0;
+  const int iH0 = _vertexHalfEdge[iV];
+  if(iH0<0) return 0;
+  int n = 0, iH = iH0;
+  do { n++; iH = _prev[iH]^1; } while(iH!=iH0);
+  return n;
+}
+
+bool EditableMesh::isBoundaryHalfEdge(const int iH) const {
+  return isHalfEdge(iH) && _face[iH]<0;
+}
+
+bool EditableMesh::isBoundaryEdge(const int iE) const {
+  return isEdge(iE) && (_face[2*iE]<0 || _face[2*iE+1]<0);
+}
+
+bool EditableMesh::isBoundaryVertex(const int iV) const {
+  return isVertex(iV) && _vertexHalfEdge[iV]>=0 && _face[_vertexHalfEdge[iV]]<0;
+}
+
+// editing operators
+
+bool EditableMesh::flipEdge(const int iE) {
+  if(!isEdge(iE)) return false;
+  const int iH = 2*iE, iT = iH+1;
+  const int iF = _face[iH], iG = _face[iT];
+  if(iF<0 || iG<0 || getFaceSize(iF)!=3 || getFaceSize(iG)!=3) return false;
+
+  /*         iVc                        iVc         */
+  /*        /   \                      / | \        */
+  /*   iP1 /  iF \ iN1                /  |  \       */
+  /*      /  iH   \                  /   |   \      */
+  /*   iVa ------> iVb    ==>     iVa iG | iF iVb   */
+  /*      \ <----- /                 \ iT|iH /      */
+  /*   iN2 \ iT iG/ iP2               \  |  /       */
+  /*        \    /                     \ | /        */
+  /*         iVd                        iVd         */
+  const int iN1 = _next[iH], iP1 = _prev[iH];
+  const int iN2 = _next[iT], iP2 = _prev[iT];
+  const int iVa = _src[iH], iVb = _src[iT];
+  const int iVc = _src[iP1], iVd = _src[iP2];
+  if(iVc==iVd || getEdge(iVc,iVd)>=0) return false;
+
+  if(_vertexHalfEdge[iVa]==iH) _vertexHalfEdge[iVa] = iN2;
+  if(_vertexHalfEdge[iVb]==iT) _vertexHalfEdge[iVb] = iN1;
+
+  // iF = (iVc,iVd,iVb) and iG = (iVd,iVc,iVa)
+  _src[iH] = iVc;
+  _link(iH,iP2); _link(iP2,iN1); _link(iN1,iH);
+  _face[iP2] = iF;
+  _faceHalfEdge[iF] = iH;
+  _src[iT] = iVd;
+  _link(iT,iP1); _link(iP1,iN2); _link(iN2,iT);
+  _face[iP1] = iG;
+  _faceHalfEdge[iG] = iT;
+  return true;
+}
+
+int EditableMesh::splitEdge(const int iE) {
+  if(!isEdge(iE)) return -1;
+  const int iH = 2*iE, iT = iH+1;
+  const int iVa = _src[iH], iVb = _src[iT];
+
+  const int iVm = _newVertex();
+  for(int j=0;j<3;j++)
+    _coord[3*iVm+j] = 0.5f*(_coord[3*iVa+j]+_coord[3*iVb+j]);
+
+  // iH=(iVa,iVm) is followed by iG=(iVm,iVb) on its face, and
+  // iT=(iVm,iVa) is preceded by iG^1=(iVb,iVm) on its face
+  const int iG = 2*_newEdge();
+  _src[iG]    = iVm;
+  _face[iG]   = _face[iH];
+  _link(iG,_next[iH]);
+  _link(iH,iG);
+  _src[iG^1]  = iVb;
+  _face[iG^1] = _face[iT];
+  _link(_prev[iT],iG^1);
+  _link(iG^1,iT);
+  _src[iT]    = iVm;
+
+  if(_vertexHalfEdge[iVb]==iT) _vertexHalfEdge[iVb] = iG^1;
+  _vertexHalfEdge[iVm] = (_face[iG]<0)?iG:iT;
+  return iVm;
+}
+
+int EditableMesh::splitFace(const int iH0, const int iH1) {
+  if(!isHalfEdge(iH0) || !isHalfEdge(iH1)) return -1;
+  const int iF = _face[iH0];
+  if(iF<0 || _face[iH1]!=iF || iH0==iH1 || _next[iH0]==iH1 || _next[iH1]==iH0)
+    return -1;
+  const int iV0 = _src[iH0], iV1 = _src[iH1];
+  if(getEdge(iV0,iV1)>=0) return -1;
+
+  const int iP0 = _prev[iH0], iP1 = _prev[iH1];
+  const int iE  = _newEdge();
+  const int iFn = _newFace();
+  const int iG  = 2*iE;
+
+  // iF keeps the half-edges from iH0 to iP1, closed by iG=(iV1,iV0),
+  // and iFn gets the ones from iH1 to iP0, closed by iG^1=(iV0,iV1)
+  _src[iG]   = iV1;
+  _src[iG^1] = iV0;
+  _face[iG]  = iF;
+  _link(iP1,iG);   _link(iG,iH0);
+  _link(iP0,iG^1); _link(iG^1,iH1);
+  _faceHalfEdge[iF]  = iH0;
+  _faceHalfEdge[iFn] = iH1;
+  int iH = iH1;
+  do { _face[iH] = iFn; iH = _next[iH]; } while(iH!=iH1);
+  return iE;
+}
+
+bool EditableMesh::_isCollapsibleSide(const int iH) const {
+  // if the face of iH is a triangle, its other two edges are merged
+  // into one, which needs a face on at least one side, and different
+  // faces on the two sides
+  if(_face[iH]<0 || _next[_next[_next[iH]]]!=iH) return true;
+  return _face[_next[iH]^1]!=_face[_prev[iH]^1];
+}
+
+bool EditableMesh::isCollapseOk(const int iE) const {
+  if(!isEdge(iE)) return false;
+  const int iH = 2*iE, iT = iH+1;
+  const int iVa = _src[iH], iVb = _src[iT];
+  if(!isBoundaryEdge(iE) && isBoundaryVertex(iVa) && isBoundaryVertex(iVb))
+    return false;
+  if(!_isCollapsibleSide(iH) || !_isCollapsibleSide(iT))
+    return false;
+
+  // vertices opposite to iE on the incident triangles, if any
+  const bool triH = _face[iH]>=0 && _next[_next[_next[iH]]]==iH;
+  const bool triT = _face[iT]>=0 && _next[_next[_next[iT]]]==iT;
+  const int iVc = triH?_src[_prev[iH]]:-1;
+  const int iVd = triT?_src[_prev[iT]]:-1;
+
+  // link condition
+  const unsigned stamp = _nextStamp();
+  int iG = iH;
+  do { _vertexStamp[_src[iG^1]] = stamp; iG = _prev[iG]^1; } while(iG!=iH);
+  iG = iT;
+  do {
+    const int iV = _src[iG^1];
+    if(iV!=iVa && iV!=iVc && iV!=iVd && _vertexStamp[iV]==stamp) return false;
+    iG = _prev[iG]^1;
+  } while(iG!=iT);
+  return true;
+}
+
+int EditableMesh::collapseEdge(const int iE) {
+  if(!isCollapseOk(iE)) return -1;
+  const int iH = 2*iE, iT = iH+1;
+  const int iVa = _src[iH], iVb = _src[iT];
+
+  for(int j=0;j<3;j++)
+    _coord[3*iVa+j] = 0.5f*(_coord[3*iVa+j]+_coord[3*iVb+j]);
+
+  // an outgoing half-edge of iVa which survives the collapse
+  const bool triH = _face[iH]>=0 && _next[_next[_next[iH]]]==iH;
+  const int iHa = triH?(_prev[iH]^1):_next[iH];
+
+  // the outgoing half-edges of iVb become outgoing half-edges of iVa
+  int iG = iT;
+  do { _src[iG] = iVa; iG = _prev[iG]^1; } while(iG!=iT);
+
+  for(const int iS : {iH,iT}) {
+    const int iF = _face[iS];
+    const int iN = _next[iS], iP = _prev[iS];
+    if(iF>=0 && _next[iN]==iP) {
+      // the triangle iF is deleted, and the edges of iN and iP are
+      // merged into the edge of iP, which takes the place of iN^1
+      _replaceHalfEdge(iP,iN^1);
+      _deleteEdge(iN/2);
+      _deleteFace(iF);
+    } else {
+      _link(iP,iN);
+      if(iF>=0 && _faceHalfEdge[iF]==iS) _faceHalfEdge[iF] = iN;
+    }
+  }
+  _deleteEdge(iE);
+  _deleteVertex(iVb);
+  _setVertexHalfEdge(iVa,iHa);
+  return iVa;
+}
+
+int EditableMesh::removeVertex(const int iV) {
+  if(!isVertex(iV) || _vertexHalfEdge[iV]<0 || isBoundaryVertex(iV))
+    return -1;
+
+  // outgoing half-edges, in rotation order, and incident faces, which
+  // must be pairwise distinct
+  _ring.clear();
+  const unsigned stamp = _nextStamp();
+  const int iH0 = _vertexHalfEdge[iV];
+  int iH = iH0;
+  do {
+    const int iF = _face[iH];
+    if(_faceStamp[iF]==stamp) return -1;
+    _faceStamp[iF] = stamp;
+    _ring.push_back(iH);
+    iH = _prev[iH]^1;
+  } while(iH!=iH0);
+
+  // the half-edges of face(iH) not incident to iV go from
+  // _next[iH] to _prev[_prev[iH]]; none of them may have its twin
+  // on another incident face, and their sources, which are the
+  // corners of the merged face, must be pairwise distinct
+  for(const int iG : _ring) {
+    for(int iX=_next[iG];iX!=_prev[iG];iX=_next[iX]) {
+      const int iF = _face[iX^1];
+      if(iF>=0 && _faceStamp[iF]==stamp) return -1;
+      if(_vertexStamp[_src[iX]]==stamp) return -1;
+      _vertexStamp[_src[iX]] = stamp;
+    }
+  }
+
+  // chain the half-edges of consecutive faces; the chain of face(iG)
+  // ends at the destination of the next outgoing half-edge, where the
+  // chain of the next face begins
+  const int n = static_cast<int>(_ring.size());
+  int iFm = _face[_ring[0]];
+  for(int j=0;j<n;j++) {
+    const int iG  = _ring[j];
+    const int iGn = _ring[(j+1<n)?j+1:0];
+    iFm = std::min(iFm,_face[iG]);
+    _link(_prev[_prev[iG]],_next[iGn]);
+    const int iW = _src[iG^1];
+    if(_vertexHalfEdge[iW]==(iG^1)) _vertexHalfEdge[iW] = _next[iG];
+  }
+  const int iHm = _next[_ring[0]];
+  for(const int iG : _ring) {
+    if(_face[iG]!=iFm) _deleteFace(_face[iG]);
+    _deleteEdge(iG/2);
+  }
+  iH = iHm;
+  do { _face[iH] = iFm; iH = _next[iH]; } while(iH!=iHm);
+  _faceHalfEdge[iFm] = iHm;
+  _deleteVertex(iV);
+  return iFm;
+}
+
+// private methods
+
+int EditableMesh::_newVertex() {
+  int iV;
+  if(!_freeVertex.empty()) {
+    iV = _freeVertex.back();
+    _freeVertex.pop_back();
+    _vertexDeleted[iV] = false;
+    _vertexHalfEdge[iV] = -1;
+  } else {
+    iV = getVertexRange();
+    _coord.resize(_coord.size()+3,0.0f);
+    _vertexHalfEdge.push_back(-1);
+    _vertexDeleted.push_back(false);
+    _vertexStamp.push_back(0);
+  }
+  _nVertices++;
+  return iV;
+}
+
+int EditableMesh::_newEdge() {
+  int iE;
+  if(!_freeEdge.empty()) {
+    iE = _freeEdge.back();
+    _freeEdge.pop_back();
+  } else {
+    iE = getEdgeRange();
+    _src.resize(2*iE+2);
+    _next.resize(2*iE+2);
+    _prev.resize(2*iE+2);
+    _face.resize(2*iE+2);
+  }
+  for(int iH=2*iE;iH<2*iE+2;iH++) {
+    _src[iH] = _next[iH] = _prev[iH] = _face[iH] = -1;
+  }
+  _nEdges++;
+  return iE;
+}
+
+int EditableMesh::_newFace() {
+  int iF;
+  if(!_freeFace.empty()) {
+    iF = _freeFace.back();
+    _freeFace.pop_back();
+  } else {
+    iF = getFaceRange();
+    _faceHalfEdge.push_back(-1);
+    _faceStamp.push_back(0);
+  }
+  _nFaces++;
+  return iF;
+}
+
+void EditableMesh::_deleteVertex(const int iV) {
+  _vertexDeleted[iV] = true;
+  _vertexHalfEdge[iV] = -1;
+  _freeVertex.push_back(iV);
+  _nVertices--;
+}
+
+void EditableMesh::_deleteEdge(const int iE) {
+  for(int iH=2*iE;iH<2*iE+2;iH++) {
+    _src[iH] = _next[iH] = _prev[iH] = _face[iH] = -1;
+  }
+  _freeEdge.push_back(iE);
+  _nEdges--;
+}
+
+void EditableMesh::_deleteFace(const int iF) {
+  _faceHalfEdge[iF] = -1;
+  _freeFace.push_back(iF);
+  _nFaces--;
+}
+
+void EditableMesh::_link(const int iH0, const int iH1) {
+  _next[iH0] = iH1;
+  _prev[iH1] = iH0;
+}
+
+void EditableMesh::_setVertexHalfEdge(const int iV, const int iH) {
+  // prefer a boundary half-edge
+  int iG = iH;
+  do {
+    if(_face[iG]<0) { _vertexHalfEdge[iV] = iG; return; }
+    iG = _prev[iG]^1;
+  } while(iG!=iH);
+  _vertexHalfEdge[iV] = iH;
+}
+
+void EditableMesh::_replaceHalfEdge(const int iH, const int iOld) {
+  // iH takes the place of iOld, which has the same source vertex, on
+  // the face or boundary loop of iOld
+  const int iF = _face[iOld];
+  _face[iH] = iF;
+  _link(_prev[iOld],iH);
+  _link(iH,_next[iOld]);
+  if(iF>=0 && _faceHalfEdge[iF]==iOld) _faceHalfEdge[iF] = iH;
+  if(_vertexHalfEdge[_src[iOld]]==iOld) _vertexHalfEdge[_src[iOld]] = iH;
+}
+
+unsigned EditableMesh::_nextStamp() const {
+  if(++_stamp==0) {
+    std::fill(_vertexStamp.begin(),_vertexStamp.end(),0);
+    std::fill(_faceStamp.begin(),_faceStamp.end(),0);
+    _stamp = 1;
+  }
+  return _stamp;
+}
@@ -0,0 +1,271 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// EditableMesh.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#pragma once
+
+#include <vector>
+
+class IndexedFaceSet;
+
+class EditableMesh {
+
+  // - mutable half-edge representation of an oriented manifold polygon
+  //   mesh, which supports local edits without rebuilding the
+  //   topology of the whole mesh
+  // - the two half-edges of edge iE are 2*iE and 2*iE+1, so the twin
+  //   of half-edge iH is iH^1 and its edge is iH/2; the half-edges of
+  //   each face, and the boundary half-edges of each boundary loop,
+  //   are linked in circular next/prev lists; boundary half-edges
+  //   have face -1
+  // - the outgoing half-edge of a boundary vertex is always a boundary
+  //   half-edge, so isBoundaryVertex() runs in constant time
+  // - deleted vertices, edges, and faces leave holes in their index
+  //   ranges, which are kept in free lists and reused by the
+  //   following operations; getNumberOfVertices(), ... count the
+  //   elements in use, and getVertexRange(), ... return the size of
+  //   the index ranges
+  // - the editing operators only touch the elements incident to the
+  //   edge, face, or vertex being edited; their cost depends on the
+  //   face sizes and vertex valences involved, but not on the size of
+  //   the mesh
+  // - methods taking an index return -1 or false if the index is out
+  //   of range or refers to a deleted element
+  // - unlike the read-only topology classes, EditableMesh is not
+  //   templated on the index type: it is built from and exported to
+  //   IndexedFaceSet, whose coordIndex is a std::vector<int>, so its
+  //   index ranges never exceed those of int, and 32 bit links keep
+  //   the per half-edge arrays small
+
+public:
+
+  EditableMesh();
+
+  // - builds the mesh from an array of 3D vertex coordinates and a
+  //   coordIndex array in the IndexedFaceSet format
+  // - the faces must have at least three corners, must not repeat a
+  //   vertex, and every edge must be shared by at most two faces with
+  //   opposite orientations; otherwise the constructor throws
+  //   std::runtime_error
+  // - vertices not used by any face are kept as isolated vertices
+  EditableMesh(const std::vector<float>& coord,
+               const std::vector<int>& coordIndex);
+
+  // same as above, using the coord and coordIndex fields of ifs
+  explicit EditableMesh(IndexedFaceSet& ifs);
+
+  // replaces the current mesh; it throws std::runtime_error under the
+  // same conditions as the constructor, leaving the mesh empty
+  void build(const std::vector<float>& coord,
+             const std::vector<int>& coordIndex);
+
+  // - writes the mesh into coord and coordIndex arrays in the
+  //   IndexedFaceSet format, with the vertices and faces renumbered
+  //   in increasing index order, skipping the deleted ones
+  // - if the mesh has not been edited, the input arrays are
+  //   reproduced exactly
+  void exportMesh(std::vector<float>& coord,
+                  std::vector<int>& coordIndex) const;
+
+  // - same as above, writing into the coord and coordIndex fields of
+  //   ifs; since the vertex and face indices may change, the normal,
+  //   color, and texCoord properties of ifs are cleared
+  void exportMesh(IndexedFaceSet& ifs) const;
+
+  // number of elements in use
+  int   getNumberOfVertices() const;
+  int   getNumberOfEdges() const;
+  int   getNumberOfFaces() const;
+
+  // size of the index ranges, including the deleted elements
+  int   getVertexRange() const;
+  int   getEdgeRange() const;
+  int   getFaceRange() const;
+
+  // return true if the index is in range and the element is in use
+  bool  isVertex(int iV) const;
+  bool  isEdge(int iE) const;
+  bool  isFace(int iF) const;
+  bool  isHalfEdge(int iH) const;
+
+  const float* getCoord(int iV) const;
+  void         setCoord(int iV, float x, float y, float z);
+
+  // half-edge connectivity
+  int   getSrc(int iH) const;
+  int   getDst(int iH) const;
+  int   getNext(int iH) const;
+  int   getPrev(int iH) const;
+  int   getTwin(int iH) const;
+  int   getFace(int iH) const;
+  int   getEdge(int iH) const;
+
+  // the two half-edges of edge iE, j=0,1
+  int   getEdgeHalfEdge(int iE, int j) const;
+
+  // - returns the edge joining iV0 and iV1, or -1 if there is none
+  // - this method rotates around iV0
+  int   getEdge(int iV0, int iV1) const;
+
+  // - returns an outgoing half-edge of iV, which is a boundary
+  //   half-edge if iV is a boundary vertex; returns -1 for isolated
+  //   vertices
+  // - the outgoing half-edges of iV can be visited as follows
+  //
+  // int iH0 = mesh.getVertexHalfEdge(iV);
+  // if(iH0>=0) {
+  //   int iH = iH0;
+  //   do {
+  //     // ...
+  //     iH = mesh.getTwin(mesh.getPrev(iH));
+  //   } while(iH!=iH0);
+  // }
+  int   getVertexHalfEdge(int iV) const;
+
+  // returns one of the half-edges of face iF
+  int   getFaceHalfEdge(int iF) const;
+
+  int   getFaceSize(int iF) const;
+  int   getValence(int iV) const;
+
+  bool  isBoundaryHalfEdge(int iH) const;
+  bool  isBoundaryEdge(int iE) const;
+  bool  isBoundaryVertex(int iV) const;
+
+  // editing operators
+
+  // - replaces edge iE, shared by two triangles, by the other diagonal
+  //   of the quadrilateral formed by the two triangles; edge iE keeps
+  //   its index
+  // - returns false, and leaves the mesh unchanged, if iE is a
+  //   boundary edge, if one of its two faces is not a triangle, or if
+  //   the other diagonal is already an edge of the mesh
+  bool  flipEdge(int iE);
+
+  // - inserts a new vertex at the midpoint of edge iE, which is split
+  //   into two edges; each one of the faces incident to iE gains one
+  //   corner; for triangle meshes splitEdge() is usually followed by
+  //   splitFace() on each one of those faces
+  // - returns the index of the new vertex
+  int   splitEdge(int iE);
+
+  // - splits the face containing the half-edges iH0 and iH1 in two,
+  //   by inserting a new edge from getSrc(iH1) to getSrc(iH0); the
+  //   face containing iH0 keeps its index
+  // - returns the index of the new edge, or -1, leaving the mesh
+  //   unchanged, if the two half-edges are not on the same face, if
+  //   they are equal or consecutive, or if their sources are already
+  //   joined by an edge
+  int   splitFace(int iH0, int iH1);
+
+  // - collapses edge iE into its vertex getSrc(getEdgeHalfEdge(iE,0)),
+  //   which is moved to the midpoint of the edge; the other vertex is
+  //   deleted, and each triangle incident to iE is deleted together
+  //   with one of its two remaining edges
+  // - returns the index of the remaining vertex, or -1, leaving the
+  //   mesh unchanged, if the collapse would break the manifold
+  //   structure of the mesh (see isCollapseOk)
+  int   collapseEdge(int iE);
+
+  // - returns true if the two endpoints of iE only share the
+  //   neighbors opposite to iE on the triangles incident to it (link
+  //   condition), if iE is a boundary edge whenever both endpoints
+  //   are boundary vertices, and if no edge would be left without
+  //   incident faces
+  bool  isCollapseOk(int iE) const;
+
+  // - deletes the internal vertex iV together with its incident edges,
+  //   and merges its incident faces into a single face, which keeps
+  //   the smallest of their indices
+  // - returns the index of the merged face, or -1, leaving the mesh
+  //   unchanged, if iV is a boundary or isolated vertex, if two of
+  //   its incident faces share an edge not incident to iV, or if the
+  //   merged face would repeat a vertex
+  int   removeVertex(int iV);
+
+private:
+
+  void  _build(const std::vector<float>& coord,
+               const std::vector<int>& coordIndex);
+
+  int   _newVertex();
+  int   _newEdge();
+  int   _newFace();
+  void  _deleteVertex(int iV);
+  void  _deleteEdge(int iE);
+  void  _deleteFace(int iF);
+
+  void  _link(int iH0, int iH1);
+  void  _setVertexHalfEdge(int iV, int iH);
+  void  _replaceHalfEdge(int iH, int iOld);
+  bool  _isCollapsibleSide(int iH) const;
+  unsigned _nextStamp() const;
+
+  // vertices
+  std::vector<float> _coord;
+  std::vector<int>   _vertexHalfEdge;
+  std::vector<bool>  _vertexDeleted;
+
+  // half-edges, two per edge; _src[2*iE]==-1 if edge iE is deleted
+  std::vector<int>   _src;
+  std::vector<int>   _next;
+  std::vector<int>   _prev;
+  std::vector<int>   _face;
+
+  // faces; _faceHalfEdge[iF]==-1 if face iF is deleted
+  std::vector<int>   _faceHalfEdge;
+
+  // free lists
+  std::vector<int>   _freeVertex;
+  std::vector<int>   _freeEdge;
+  std::vector<int>   _freeFace;
+
+  int _nVertices;
+  int _nEdges;
+  int _nFaces;
+
+  // scratch space used by the operators to mark vertices and faces,
+  // so that they do not have to allocate or clear per-call arrays
+  mutable std::vector<unsigned> _vertexStamp;
+  mutable std::vector<unsigned> _faceStamp;
+  mutable unsigned              _stamp;
+  std::vector<int>              _ring;
+
+};
@@ -37,133 +37,146 @@
 #include <cmath>
 #include "Faces.hpp"
 
-#include <stdexcept>
-#include <unordered_set>
-
-Faces::Faces(const int nV, const vector<int>& coordIndex)
-  : _coordIndex(coordIndex) {
-
-  std::unordered_set<int> uniqueIndexes;
-  int faceIndex = 0;
-  int coordIndexStart = 0;
-  int coordIndexEnd = 0;
-
-  for(int i : _coordIndex) {
-    if(i>=0) {
-      uniqueIndexes.insert(i);
-    }
-    else {
-      _faceMap.insert_or_assign(faceIndex, FaceCornerIndexes{ coordIndexStart, coordIndexEnd});
-      ++faceIndex;
-      coordIndexStart = coordIndexEnd + 1;
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+#include <util/Parallel.hpp>
+
+Faces::Faces(const int nV, const vector<int>& coordIndex):
+  _numbOfVertices(0),
+  _numbOfUsedVertices(0),
+  _coordIndex(coordIndex),
+  _faceFirstCorner(),
+  _usedVertex() {
+
+  const int nC = static_cast<int>(_coordIndex.size());
+
+  // 1) count the face separators and find the largest vertex index
+  //    of each chunk
+  const int nChunks = Parallel::getNumberOfChunks(nC);
+  std::vector<int> chunkFaces(nChunks+1,0);
+  std::vector<int> chunkMaxV(nChunks,-1);
+  Parallel::forChunks(nC,[&](const int iChunk, const int begin, const int end) {
+    int nF = 0, maxV = -1;
+    for(int iC=begin;iC<end;iC++) {
+      const int iV = _coordIndex[iC];
+      if(iV<0) nF++;
+      else if(iV>maxV) maxV = iV;
     }
-    ++coordIndexEnd;
+    chunkFaces[iChunk+1] = nF;
+    chunkMaxV[iChunk] = maxV;
+  });
+
+  int maxV = -1;
+  for(int iChunk=0;iChunk<nChunks;iChunk++) {
+    chunkFaces[iChunk+1] += chunkFaces[iChunk];
+    maxV = std::max(maxV,chunkMaxV[iChunk]);
   }
+  _numbOfVertices = std::max(nV,maxV+1);
+
+  // 2) record the first corner of every face, and mark the vertices
+  //    used by the corners in a bit vector; the first corner of face
+  //    iF+1 follows the separator of face iF
+  const int nF = chunkFaces[nChunks];
+  _faceFirstCorner.assign(nF+1,0);
+  _usedVertex.assign((_numbOfVertices+63)/64,0);
+  Parallel::forChunks(nC,[&](const int iChunk, const int begin, const int end) {
+    int iF = chunkFaces[iChunk];
+    for(int iC=begin;iC<end;iC++) {
+      const int iV = _coordIndex[iC];
+      if(iV<0) {
+        _faceFirstCorner[++iF] = iC+1;
+      } else {
+        std::atomic_ref<uint64_t> word(_usedVertex[iV>>6]);
+        word.fetch_or(static_cast<uint64_t>(1)<<(iV&63),std::memory_order_relaxed);
+      }
+    }
+  });
 
-  if (nV != uniqueIndexes.size()) {
-    throw std::runtime_error("Faces::Faces: number of vertices and number of indices must be equal");
-  }
-  _numbOfVertices = nV;
+  for(const uint64_t word : _usedVertex)
+    _numbOfUsedVertices += std::popcount(word);
 }
 
 int Faces::getNumberOfVertices() const {
   return _numbOfVertices;
 }
 
+int Faces::getNumberOfUsedVertices() const {
+  return _numbOfUsedVertices;
+}
+
+bool Faces::isUsedVertex(const int iV) const {
+  if (iV < 0 || iV >= _numbOfVertices)
+    return false;
+  return (_usedVertex[iV>>6]>>(iV&63))&1;
+}
+
 int Faces::getNumberOfFaces() const {
-  return static_cast<int>(_faceMap.size());
+  return static_cast<int>(_faceFirstCorner.size())-1;
 }
 
 int Faces::getNumberOfCorners() const {
-  // for the time being, we only support triangles
-  return static_cast<int>(_faceMap.size()) * 3;
+  return static_cast<int>(_coordIndex.size());
 }
 
 int Faces::getFaceSize(const int iF) const {
-
   if (!isValidFace(iF))
-    return -1;
-
-  if (const auto iter = _faceMap.find(iF); iter != _faceMap.end()) {
-    return iter->second.end - iter->second.start;
-  }
-  return -1;
+    return 0;
+  return _faceFirstCorner[iF+1]-_faceFirstCorner[iF]-1;
 }
 
 int Faces::getFaceFirstCorner(const int iF) const {
   if (!isValidFace(iF))
     return -1;
+  return _faceFirstCorner[iF];
+}
 
-  if (const auto iter = _faceMap.find(iF); iter != _faceMap.end()) {
-    return iter->second.start;
-  }
-  return -1;
+std::span<const int> Faces::getFaceVertices(const int iF) const {
+  if (!isValidFace(iF))
+    return {};
+  return std::span<const int>(_coordIndex).subspan(_faceFirstCorner[iF],getFaceSize(iF));
 }
 
 int Faces::getFaceVertex(const int iF, const int iC) const {
   if (!isValidFace(iF))
     return -1;
 
-  if (!isValidCorner(iC))
+  if (iC < _faceFirstCorner[iF] || iC >= _faceFirstCorner[iF+1]-1)
     return -1;
 
-  if (const auto iter = _faceMap.find(iF); iter != _faceMap.end()) {
-    if (iter->second.start <= iC && iC <= iter->second.end)
-      return _coordIndex[iC];
-    else
-      return -1;
-  }
-  return -1;
+  return _coordIndex[iC];
 }
 
 int Faces::getCornerFace(const int iC) const {
 
-  if (!isValidCorner(iC)) {
+  if (!isValidCorner(iC))
     return -1;
-  }
 
-  if (_coordIndex[iC] == -1)
+  if (_coordIndex[iC] < 0)
     return -1;
 
-  for (const auto& [iF, face] : _faceMap) {
-    if (face.start <= iC && iC < face.end) {
-      return iF;
-    }
-  }
-
-  return -1;
+  // the corners after the last separator do not belong to any face
+  const auto it = std::upper_bound(_faceFirstCorner.begin(),_faceFirstCorner.end(),iC);
+  const int iF = static_cast<int>(it-_faceFirstCorner.begin())-1;
+  return isValidFace(iF) ? iF : -1;
 }
 
 int Faces::getNextCorner(const int iC) const {
-  if (!isValidCorner(iC)) {
-    return -1;
-  }
 
-  if (_coordIndex[iC] == -1)
+  const int iF = getCornerFace(iC);
+  if (iF < 0)
     return -1;
 
-  for (const auto& [iF, face] : _faceMap) {
-    if (face.start <= iC && iC < face.end) {
-      if (iC + 1 < face.end)
-        return iC + 1;
-      else {
-        // it's in the next face
-        if (iF + 1 < _faceMap.size())
-          return _faceMap.at(iF + 1).start;
-      }
-    }
-  }
-
-  return -1;
+  return (iC+2 < _faceFirstCorner[iF+1]) ? iC+1 : _faceFirstCorner[iF];
 }
 
 bool Faces::isValidFace(const int iF) const
 {
-  return iF >= 0 && iF < static_cast<int>(_faceMap.size());
+  return iF >= 0 && iF < getNumberOfFaces();
 }
 
 bool Faces::isValidCorner(const int iC) const
 {
-  return (iC >= 0 && iC < _coordIndex.size());
+  return (iC >= 0 && iC < static_cast<int>(_coordIndex.size()));
 }
-
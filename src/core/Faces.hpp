@@ -36,12 +36,20 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <cstdint>
+#include <span>
 #include <vector>
 
 using namespace std;
 
 class Faces {
+
+  // the faces are stored as a flat offset array: the corners of face
+  // iF are [_faceFirstCorner[iF],_faceFirstCorner[iF+1]-1), and the
+  // face separator is at _faceFirstCorner[iF+1]-1; the constructor
+  // splits the coordIndex array into chunks processed concurrently
+  // by Parallel::forChunks()
+
 public:
 
   /**
@@ -58,6 +66,13 @@ public:
    */
   int getNumberOfVertices() const;
 
+  /**
+   * Number of vertices referenced by at least one corner; isUsedVertex(iV) tells
+   * whether vertex iV is one of them.
+   */
+  int getNumberOfUsedVertices() const;
+  bool isUsedVertex(int iV) const;
+
   /**
    * The faces are counted in the constructor by counting the number of -1's in the coordIndex array.
    * If coordIndex is not empty, the last value of coordIndex should be -1.
@@ -83,6 +98,13 @@ public:
    */
   int getFaceFirstCorner(int iF) const;
 
+  /**
+   * If iF is a valid face index, this method returns the coordIndex entries of the corners of the face iF,
+   * not including the separator; otherwise it returns an empty span.
+   *
+   */
+  std::span<const int> getFaceVertices(int iF) const;
+
   /**
    * If iF is a valid face index, and iC is a valid corner index for face iF,
    * this method returns the value stored in the corresponding coordIndex entry.
@@ -111,12 +133,9 @@ public:
 
 private:
   int _numbOfVertices;
+  int _numbOfUsedVertices;
   std::vector<int> _coordIndex;
-
-  struct FaceCornerIndexes {
-    int start = 0;
-    int end = 0;
-  };
-  std::unordered_map<int, FaceCornerIndexes> _faceMap;
+  std::vector<int> _faceFirstCorner;
+  std::vector<uint64_t> _usedVertex;
 
 };
@@ -41,13 +41,125 @@
 
 #include "Graph.hpp"
 
-Graph::Graph(const int nV):Edges(nV) {
+#include <algorithm>
+#include <atomic>
+
+#include <util/Parallel.hpp>
+
+template<class T>
+GraphT<T>::GraphT(const T nV, const Index index):
+  EdgesT<T>(nV,index),
+  _adjacencyFirst(),
+  _adjacencyVertex(),
+  _adjacencyEdge() {
+}
+
+template<class T>
+void GraphT<T>::reset(const T nV) {
+  EdgesT<T>::reset(nV);
+  _clearAdjacency();
+}
+
+template<class T>
+T GraphT<T>::insertEdge(T iV0, T iV1) {
+  const T nE = this->getNumberOfEdges();
+  const T iE = EdgesT<T>::insertEdge(iV0,iV1);
+  if(this->getNumberOfEdges()!=nE) _clearAdjacency();
+  return iE;
+}
+
+template<class T>
+void GraphT<T>::insertEdges(std::span<const std::pair<T,T>> vertexPairs,
+                            std::vector<T>* edgeIndex) {
+  const T nE = this->getNumberOfEdges();
+  EdgesT<T>::insertEdges(vertexPairs,edgeIndex);
+  if(this->getNumberOfEdges()!=nE) _clearAdjacency();
+}
+
+// adjacency
+
+template<class T>
+void GraphT<T>::buildAdjacency() {
+  const T nV = this->getNumberOfVertices();
+  const T nE = this->getNumberOfEdges();
+  const int64_t nH = 2*static_cast<int64_t>(nE);
+
+  // 1) count the edges incident to each vertex
+  std::vector<std::atomic<T>> pos(nV);
+  Parallel::forChunks(nE,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t iE=begin;iE<end;iE++) {
+      pos[this->getVertex0(static_cast<T>(iE))].fetch_add(1,std::memory_order_relaxed);
+      pos[this->getVertex1(static_cast<T>(iE))].fetch_add(1,std::memory_order_relaxed);
+    }
+  });
+  _adjacencyFirst.resize(static_cast<size_t>(nV)+1);
+  _adjacencyFirst[0] = 0;
+  for(T iV=0;iV<nV;iV++) {
+    _adjacencyFirst[iV+1] = _adjacencyFirst[iV]+pos[iV].load(std::memory_order_relaxed);
+    pos[iV].store(_adjacencyFirst[iV],std::memory_order_relaxed);
+  }
+
+  // 2) scatter (neighbor,edge) keys into the rows, sort each row so
+  //    that the result does not depend on the number of threads, and
+  //    unpack them
+  using Key = typename EdgesT<T>::Key;
+  std::vector<Key> row(nH);
+  Parallel::forChunks(nE,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t i=begin;i<end;i++) {
+      const T iE  = static_cast<T>(i);
+      const T iV0 = this->getVertex0(iE);
+      const T iV1 = this->getVertex1(iE);
+      row[pos[iV0].fetch_add(1,std::memory_order_relaxed)] = this->edgeKey(iV1,iE);
+      row[pos[iV1].fetch_add(1,std::memory_order_relaxed)] = this->edgeKey(iV0,iE);
+    }
+  });
+  Parallel::forChunks(nV,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t iV=begin;iV<end;iV++)
+      std::sort(row.begin()+_adjacencyFirst[iV],row.begin()+_adjacencyFirst[iV+1]);
+  });
+  _adjacencyVertex.resize(nH);
+  _adjacencyEdge.resize(nH);
+  Parallel::forChunks(nH,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for(int64_t j=begin;j<end;j++) {
+      _adjacencyVertex[j] = IndexTraits<T>::keyHi(row[j]);
+      _adjacencyEdge[j]   = IndexTraits<T>::keyLo(row[j]);
+    }
+  });
+}
+
+template<class T>
+bool GraphT<T>::hasAdjacency() const {
+  return !_adjacencyFirst.empty();
 }
 
-void Graph::reset(const int nV) {
-  Edges::reset(nV);
+template<class T>
+std::span<const T> GraphT<T>::getNeighbors(const T iV) const {
+  if(!hasAdjacency() || !IndexTraits<T>::inRange(iV,this->getNumberOfVertices()))
+    return {};
+  return {_adjacencyVertex.data()+_adjacencyFirst[iV],
+          static_cast<size_t>(_adjacencyFirst[iV+1]-_adjacencyFirst[iV])};
 }
 
-int Graph::insertEdge(int iV0, int iV1) {
-  return Edges::insertEdge(iV0,iV1);
+template<class T>
+std::span<const T> GraphT<T>::getNeighborEdges(const T iV) const {
+  if(!hasAdjacency() || !IndexTraits<T>::inRange(iV,this->getNumberOfVertices()))
+    return {};
+  return {_adjacencyEdge.data()+_adjacencyFirst[iV],
+          static_cast<size_t>(_adjacencyFirst[iV+1]-_adjacencyFirst[iV])};
 }
+
+template<class T>
+T GraphT<T>::getDegree(const T iV) const {
+  return static_cast<T>(getNeighbors(iV).size());
+}
+
+template<class T>
+void GraphT<T>::_clearAdjacency() {
+  _adjacencyFirst.clear();
+  _adjacencyVertex.clear();
+  _adjacencyEdge.clear();
+}
+
+template class GraphT<int>;
+template class GraphT<uint32_t>;
+template class GraphT<int64_t>;
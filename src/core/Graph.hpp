@@ -42,10 +42,11 @@
 
 #include "Edges.hpp"
 
-class Graph : public Edges {
+template<class T>
+class GraphT : public EdgesT<T> {
 
   // - The Graph class is identical to the Edges class with the
-  //   insertEdge method made public
+  //   insertEdge method made public, and an optional adjacency index
   
 public:
 
@@ -56,11 +57,56 @@ public:
   // int     getEdge(const int iV0, const int iV1)     const;
   // int     getVertex0(const int iE)                  const;
   // int     getVertex1(const int iE)                  const;
+  // Index   getIndex()                                const;
 
-  explicit Graph(int nV);
+  using typename EdgesT<T>::Index;
+  using EdgesT<T>::LINKED_LIST;
+  using EdgesT<T>::HASH;
+  using EdgesT<T>::SORTED;
 
-  void reset(int nV);
+  explicit GraphT(T nV, Index index=LINKED_LIST);
 
-  int insertEdge(int iV0, int iV1);
+  void reset(T nV);
+
+  T insertEdge(T iV0, T iV1);
+
+  void insertEdges(std::span<const std::pair<T,T>> vertexPairs,
+                   std::vector<T>* edgeIndex=nullptr);
+
+  // adjacency
+
+  // - builds a frozen snapshot of the adjacency of the graph, stored
+  //   as CSR arrays, with the neighbors of each vertex in increasing
+  //   order; the lists are filled and sorted in parallel
+  // - the snapshot is discarded by reset(), and by insertEdge() and
+  //   insertEdges() when they add new edges; until it is built again
+  //   the methods below return empty spans and 0
+  void buildAdjacency();
+  bool hasAdjacency() const;
+
+  // vertices joined to iV by an edge
+  std::span<const T> getNeighbors(T iV) const;
+
+  // edges incident to iV, in the same order as getNeighbors(iV)
+  std::span<const T> getNeighborEdges(T iV) const;
+
+  // number of edges incident to iV, which is the size of
+  // getNeighbors(iV)
+  T getDegree(T iV) const;
+
+private:
+
+  void _clearAdjacency();
+
+  // optional adjacency; empty until buildAdjacency() is called
+  std::vector<T> _adjacencyFirst;
+  std::vector<T> _adjacencyVertex;
+  std::vector<T> _adjacencyEdge;
 
 };
+
+extern template class GraphT<int>;
+extern template class GraphT<uint32_t>;
+extern template class GraphT<int64_t>;
+
+using Graph = GraphT<int>;
@@ -47,13 +47,18 @@
 #include <format>
 #include <stdexcept>
 
+#include <algorithm>
+#include <utility>
+
 #include "Graph.hpp"
+#include <util/Parallel.hpp>
 
 // 1) all half edges corresponding to regular mesh edges are made twins
 // 2) all the other edges are made boundary half edges (twin==-1)
 
-HalfEdges::HalfEdges(const int nVertices, const std::vector<int>& coordIndex):
-  Edges(nVertices), // a graph with no edges is created here
+template<class T>
+HalfEdgesT<T>::HalfEdgesT(const T nVertices, const std::vector<T>& coordIndex):
+  EdgesT<T>(nVertices), // a graph with no edges is created here
   _coordIndex(coordIndex),
   _twin(),
   _face(),
@@ -72,26 +77,44 @@ HalfEdges::HalfEdges(const int nVertices, const std::vector<int>& coordIndex):
   //   if _coordIndex[iC]<0 then
   //   _face[
   
-  int nV = nVertices;
-  int nC = static_cast<int>(_coordIndex.size()); // number of corners
+  T nV = nVertices;
+  T nC = static_cast<T>(_coordIndex.size()); // number of corners
 
   /**
    * 0) just to be safe, verify that for each corner iC that -1<=iV && iV<nV, where iV=coordIndex[iC]
    * if you find a violation, you can increment and the variable nV, and then use the method Edges::_reset()
    * to adjust the number of vertices of the graph, if necessary; or you can abort throwing an exception
    **/
-  for (int iC = 0; iC < nC; ++iC) {
-    const int iV = _coordIndex[iC];
-    if ((-1 > iV || iV >= nV)) {
+  for (T iC = 0; iC < nC; ++iC) {
+    const T iV = _coordIndex[iC];
+    if (iV != IndexTraits<T>::none && !IndexTraits<T>::inRange(iV, nV)) {
       throw std::runtime_error(std::format("Unexpected coordIndex value {} at {} position.", iV, iC));
     }
   }
 
+  // 1) - 6) build the half-edge relations, either with three serial
+  //    passes over the corners, or by sorting the half-edges by edge
+  //    on multiple threads; both give identical results
+  if(Parallel::getNumberOfThreads()>1)
+    _buildSorted();
+  else
+    _buildSerial();
+}
+
+// the three pass serial construction
+
+template<class T>
+void HalfEdgesT<T>::_buildSerial() {
+
+  constexpr T none = IndexTraits<T>::none;
+  T nV = getNumberOfVertices();
+  T nC = static_cast<T>(_coordIndex.size()); // number of corners
+
   /**
-   * 1) create an empty vector<int> to count the number of incident faces per edge;
+   * 1) create an empty vector<T> to count the number of incident faces per edge;
    * size is not known at this point because the edges have not been created yet
    **/
-  std::vector<int> nFacesEdge;
+  std::vector<T> nFacesEdge;
   nFacesEdge.reserve(nV + 1);
 
   /**
@@ -99,31 +122,34 @@ HalfEdges::HalfEdges(const int nVertices, const std::vector<int>& coordIndex):
    * so that all the half edges are boundary, count the number of incident faces per edge,
    * fill the _face array, and count the number of faces incident to each edge
    **/
-  _twin.resize(nC, -1);
-  _face.resize(nC, -1);
+  _twin.resize(nC, none);
+  _face.resize(nC, none);
+  _faceFirstCorner.clear();
 
-  int iV0,iV1,iF,iE,iC0,iC1;
-  int nF = 0;
+  T iV0,iV1,iF,iE,iC0,iC1;
+  T nF = 0;
   for(iF=iC0=iC1=0; iC1<nC; iC1++) {
-    if(_coordIndex[iC1]>=0)
+    if(_coordIndex[iC1]!=none)
         continue;
     // face iF comprises corners iC0<=iC<iC1
     // - each corner in this range corresponds to one half edge
     // - find the next corner within the face
     // - get the two vertex indices and insert an edge in the graph if
     //   not already there
-    for (int iC = iC0; iC < iC1; ++iC) {
+    for (T iC = iC0; iC < iC1; ++iC) {
 
       _face[iC] = iF;
 
       iV0 = _coordIndex[iC];
       iV1 = _coordIndex[iC+1];
-      if (iV1 == -1)
+      if (iV1 == none)
         iV1 = _coordIndex[iC0];
 
       // - note that Edges::_insertEdge return the edge index number of
       //   a newly created edge, or the index of an existing edge
-      iE = insertEdge(iV0,iV1);
+      iE = this->insertEdge(iV0,iV1);
+      // - degenerate half edges, with iV0==iV1, have no edge
+      if (iE == none) continue;
       // - note that iE might be >= nFacesEdge.size() at this point, and
       //   you may need to increase the size of nFacesEdge first
       // - ...
@@ -134,35 +160,40 @@ HalfEdges::HalfEdges(const int nVertices, const std::vector<int>& coordIndex):
     }
 
     // increment variables to continue processing next face
+    _faceFirstCorner.push_back(iC0);
     iC0 = iC1+1;
     iF++;
   }
   nF = iF;
-  int nE = getNumberOfEdges();
+  // the corners after the last face separator, if any, do not belong
+  // to any face
+  _faceFirstCorner.push_back((nF>0)?iC0:0);
+  T nE = getNumberOfEdges();
   
   // 3) create an array to hold the first twin corner for each edge
-  std::vector<int> twinCorner;
+  std::vector<T> twinCorner;
   // - the size of this array should be equal to the number of edges
   // - initialize it with -1's
-  twinCorner.resize(nE, -1);
+  twinCorner.resize(nE, none);
 
   // 4) fill the _twin array
   // - visit all the half-edges using a loop similar to the one used in step 2)
   for(iF=iC0=iC1=0; iC1<nC; iC1++) {
-    if(_coordIndex[iC1]>=0)
+    if(_coordIndex[iC1]!=none)
       continue;
 
-    for (int iC = iC0; iC < iC1; ++iC) {
+    for (T iC = iC0; iC < iC1; ++iC) {
 
       // for each half-edge iC, get the src and dst vertex indices, and from them the index iE of the corresponding edge
       iV0 = _coordIndex[iC];
       iV1 = _coordIndex[iC+1];
-      if (iV1 == -1)
+      if (iV1 == none)
         iV1 = _coordIndex[iC0];
 
       iE = getEdge(iV0,iV1);
+      if (iE == none) continue;
       // if twinCorner[iE]<1 save iC in twinCorner[iE]
-      if (twinCorner[iE] < 0) {
+      if (twinCorner[iE] == none) {
         twinCorner[iE] = iC;
       }
       else {
@@ -209,38 +240,40 @@ HalfEdges::HalfEdges(const int nVertices, const std::vector<int>& coordIndex):
    * 5) initialize the array of arrays representing the half-edge to edge incident relationships _firstCornerEdge,
    * and _cornerEdge
    * - the size of _firstCornerEdge should be equal to nE+1
-   * - the size of _cornerEdge should be equal to the number of valid corners (nC-nF)
+   * - the size of _cornerEdge should be equal to the number of valid corners (nC-nF), minus the degenerate half edges
    * - set boundaries
    *    _firstCornerEdge[0]=0
    *    _firstCornerEdge[iE+1] = _firstCornerEdge[iE]+nFacesEdge[iE] (1<=iE<nE)
    *
    **/
-  _firstCornerEdge.resize(nE+1, -1);
-  _cornerEdge.resize(nC-nF, -1);
+  _firstCornerEdge.resize(nE+1, none);
 
   _firstCornerEdge[0] = 0;
   for (iE=0; iE < nE; ++iE) {
     _firstCornerEdge[iE+1] = _firstCornerEdge[iE]+nFacesEdge[iE];
   }
+  // degenerate half edges are left out
+  _cornerEdge.resize(_firstCornerEdge[nE], none);
 
   // 6) fill the array of arrays
   // - the indices of corners incident to edge iE (1 if boundary, 2 if regular, >2 if singular)
   // should be stored consecutively in _cornerEdge starting at the location _firstCornerEdge[iE]
 
   for(iC0=iC1=0; iC1<nC; iC1++) {
-    if(_coordIndex[iC1]>=0)
+    if(_coordIndex[iC1]!=none)
       continue;
-    for (int iC = iC0; iC < iC1; ++iC) {
+    for (T iC = iC0; iC < iC1; ++iC) {
       // for each half-edge iC, get the src and dst vertex indices, and from them the index iE of the corresponding edge
       iV0 = _coordIndex[iC];
       iV1 = _coordIndex[iC+1];
-      if (iV1 == -1)
+      if (iV1 == none)
         iV1 = _coordIndex[iC0];
 
       iE = getEdge(iV0,iV1);
-      int start = _firstCornerEdge[iE];
-      for (int j = 0; j < nFacesEdge[iE]; ++j) {
-        if (_cornerEdge[start+j] < 0) {
+      if (iE == none) continue;
+      T start = _firstCornerEdge[iE];
+      for (T j = 0; j < nFacesEdge[iE]; ++j) {
+        if (_cornerEdge[start+j] == none) {
           _cornerEdge[start+j] = iC;
           break;
         }
@@ -250,9 +283,17 @@ HalfEdges::HalfEdges(const int nVertices, const std::vector<int>& coordIndex):
     iC0 = iC1+1;
   }
 
+  // 7) only regular edges have twins; the links set in step 3 for
+  //    the corners of singular edges are removed
+  for (iE=0; iE < nE; ++iE) {
+    if (nFacesEdge[iE] > 2) {
+      for (T j = _firstCornerEdge[iE]; j < _firstCornerEdge[iE+1]; ++j)
+        _twin[_cornerEdge[j]] = none;
+    }
+  }
 
   // for (iE=0; iE < nE; ++iE) {
-  //   int start = _firstCornerEdge[iE];
+  //   T start = _firstCornerEdge[iE];
   //   // boundary
   //   if (nFacesEdge[iE] == 1) {
   //     _cornerEdge[start] = twinCorner[iE];
@@ -268,107 +309,296 @@ HalfEdges::HalfEdges(const int nVertices, const std::vector<int>& coordIndex):
   // }
 }
 
-int HalfEdges::getNumberOfCorners() const
+// the sort based construction
+//
+// - one record (edgeKey,iC) is emitted per half-edge, where edgeKey
+//   packs the two ends of the half-edge in increasing order; corners
+//   which are not half-edges get a key larger than any edge key
+// - the records are radix sorted by key; since the sort is stable,
+//   the corners of each run of equal keys are in increasing order, as
+//   they would be visited by the serial passes
+// - the edge indices are assigned to the runs in order of their first
+//   corners, which is the order in which the serial path inserts them
+
+template<class T>
+void HalfEdgesT<T>::_buildSorted() {
+
+  constexpr T none = IndexTraits<T>::none;
+  const T nV = getNumberOfVertices();
+  const T nC = static_cast<T>(_coordIndex.size());
+
+  // the keys pack two vertex indices of bitsV bits each, and the
+  // largest 2*bitsV bit value is reserved for noEdge
+  int bitsV = 1;
+  while((static_cast<uint64_t>(1)<<bitsV)<static_cast<uint64_t>(nV)) bitsV++;
+  if(bitsV>31) {
+    _buildSerial();
+    return;
+  }
+
+  _twin.assign(nC,none);
+  _face.assign(nC,none);
+  _faceFirstCorner.clear();
+  _firstCornerEdge.clear();
+  _cornerEdge.clear();
+  const int      nBits   = 2*bitsV;
+  const uint64_t noEdge  = (static_cast<uint64_t>(1)<<nBits)-1;
+  auto           pack    = [bitsV](T iV0, T iV1) {
+    if(iV0>iV1) std::swap(iV0,iV1);
+    return (static_cast<uint64_t>(iV0)<<bitsV)|static_cast<uint64_t>(iV1);
+  };
+
+  // 1) split the corners into chunks made of whole faces, so that
+  //    each chunk can find the dst of its half-edges; the corners
+  //    after the last face separator do not belong to any face
+  const int nChunks = Parallel::getNumberOfChunks(nC);
+  std::vector<T> chunkFirst(nChunks+1,nC);
+  chunkFirst[0] = 0;
+  for(int iChunk=1;iChunk<nChunks;iChunk++) {
+    T iC = std::max(static_cast<T>((static_cast<int64_t>(nC)*iChunk)/nChunks),
+                      chunkFirst[iChunk-1]);
+    while(iC<nC && (iC==0 || _coordIndex[iC-1]!=none)) iC++;
+    chunkFirst[iChunk] = iC;
+  }
+
+  // 2) count the faces of each chunk, to number them globally
+  std::vector<T> chunkFaces(nChunks+1,0);
+  Parallel::run(nChunks,[&](const int iChunk) {
+    T nF = 0;
+    for(T iC=chunkFirst[iChunk];iC<chunkFirst[iChunk+1];iC++)
+      if(_coordIndex[iC]==none) nF++;
+    chunkFaces[iChunk+1] = nF;
+  });
+  for(int iChunk=0;iChunk<nChunks;iChunk++)
+    chunkFaces[iChunk+1] += chunkFaces[iChunk];
+
+  // 3) fill the _face and _faceFirstCorner arrays, and emit the
+  //    records
+  const T nF = chunkFaces[nChunks];
+  _faceFirstCorner.assign(nF+1,0);
+  if(nF>0) {
+    T iC = nC;
+    while(_coordIndex[iC-1]!=none) iC--;
+    _faceFirstCorner[nF] = iC;
+  }
+  std::vector<uint64_t> key(nC,noEdge);
+  std::vector<T>      corner(nC);
+  Parallel::run(nChunks,[&](const int iChunk) {
+    T iF = chunkFaces[iChunk];
+    for(T iC0=chunkFirst[iChunk],iC1=iC0;iC1<chunkFirst[iChunk+1];iC1++) {
+      corner[iC1] = iC1;
+      if(_coordIndex[iC1]!=none) continue;
+      for(T iC=iC0;iC<iC1;iC++) {
+        _face[iC] = iF;
+        const T iV0 = _coordIndex[iC];
+        const T iV1 = _coordIndex[(iC+1<iC1)?iC+1:iC0];
+        if(iV0!=iV1) key[iC] = pack(iV0,iV1);
+      }
+      _faceFirstCorner[iF] = iC0;
+      iC0 = iC1+1;
+      iF++;
+    }
+  });
+
+  // 4) sort the records by edge
+  Parallel::radixSort(key,corner,nBits);
+  const T nH = static_cast<T>(std::lower_bound(key.begin(),key.end(),noEdge)-key.begin());
+
+  // 5) flag the first corner of every run, and number the runs in
+  //    corner order; edgeOfCorner[iC] is the edge index of the run
+  //    whose first corner is iC, and -1 otherwise
+  std::vector<T> edgeOfCorner(nC,none);
+  Parallel::forChunks(nH,[&](int /*iChunk*/, T begin, T end) {
+    for(T h=begin;h<end;h++)
+      if(h==0 || key[h]!=key[h-1])
+        edgeOfCorner[corner[h]] = 0;
+  });
+  T nE = 0;
+  {
+    const int nCChunks = Parallel::getNumberOfChunks(nC);
+    std::vector<T> chunkEdges(nCChunks+1,0);
+    Parallel::forChunks(nC,[&](int iChunk, T begin, T end) {
+      T n = 0;
+      for(T iC=begin;iC<end;iC++)
+        if(edgeOfCorner[iC]==0) n++;
+      chunkEdges[iChunk+1] = n;
+    });
+    for(int iChunk=0;iChunk<nCChunks;iChunk++)
+      chunkEdges[iChunk+1] += chunkEdges[iChunk];
+    Parallel::forChunks(nC,[&](int iChunk, T begin, T end) {
+      T iE = chunkEdges[iChunk];
+      for(T iC=begin;iC<end;iC++)
+        if(edgeOfCorner[iC]==0) edgeOfCorner[iC] = iE++;
+    });
+    nE = chunkEdges[nCChunks];
+  }
+
+  // 6) size of each run, in edge order
+  std::vector<T> runFirst(nE,0);
+  _firstCornerEdge.assign(nE+1,0);
+  Parallel::forChunks(nH,[&](int /*iChunk*/, T begin, T end) {
+    for(T h=begin;h<end;h++) {
+      if(h>0 && key[h]==key[h-1]) continue;
+      T h1 = h+1;
+      while(h1<nH && key[h1]==key[h]) h1++;
+      const T iE = edgeOfCorner[corner[h]];
+      runFirst[iE] = h;
+      _firstCornerEdge[iE+1] = h1-h;
+    }
+  });
+  for(T iE=0;iE<nE;iE++)
+    _firstCornerEdge[iE+1] += _firstCornerEdge[iE];
+
+  // 7) fill the array of arrays, and the _twin array in the same way
+  //    as the serial path: only the two corners of a regular edge are
+  //    made twins of each other
+  _cornerEdge.resize(nH);
+  Parallel::forChunks(nE,[&](int /*iChunk*/, T begin, T end) {
+    for(T iE=begin;iE<end;iE++) {
+      const T h0 = runFirst[iE];
+      const T n  = _firstCornerEdge[iE+1]-_firstCornerEdge[iE];
+      const T iC0 = corner[h0];
+      for(T j=0;j<n;j++)
+        _cornerEdge[_firstCornerEdge[iE]+j] = corner[h0+j];
+      if(n==2) {
+        _twin[iC0] = corner[h0+1];
+        _twin[corner[h0+1]] = iC0;
+      }
+    }
+  });
+
+  // 8) insert the edges in the graph, in edge index order; they are
+  //    distinct by construction
+  std::vector<std::pair<T,T>> edge(nE);
+  const uint64_t maskV = (static_cast<uint64_t>(1)<<bitsV)-1;
+  Parallel::forChunks(nE,[&](int /*iChunk*/, T begin, T end) {
+    for(T iE=begin;iE<end;iE++) {
+      const uint64_t k = key[runFirst[iE]];
+      edge[iE] = std::make_pair(static_cast<T>(k>>bitsV),static_cast<T>(k&maskV));
+    }
+  });
+  this->loadEdges(edge);
+}
+
+template<class T>
+T HalfEdgesT<T>::getNumberOfCorners() const
 {
-  return static_cast<int>(_coordIndex.size());
+  return static_cast<T>(_coordIndex.size());
 }
 
 // in all subsequent methods check that the arguments are valid, and
 // return -1 if any argument is out of range
 
 // half-edge method srcVertex()
-int HalfEdges::getFace(const int iC) const {
-  if (iC < 0 || iC >= getNumberOfCorners())
-    return -1;
+template<class T>
+T HalfEdgesT<T>::getFace(const T iC) const {
+  if (!IndexTraits<T>::inRange(iC,getNumberOfCorners()))
+    return IndexTraits<T>::none;
   return _face[iC];
 }
 
 // half-edge method srcVertex()
-int HalfEdges::getSrc(const int iC) const {
-  if (iC < 0 || iC >= getNumberOfCorners())
-    return -1;
+template<class T>
+T HalfEdgesT<T>::getSrc(const T iC) const {
+  if (!IndexTraits<T>::inRange(iC,getNumberOfCorners()))
+    return IndexTraits<T>::none;
   return _coordIndex[iC];
 }
 
 // half-edge method dstVertex()
-int HalfEdges::getDst(const int iC) const {
-  if (iC < 0 || iC >= getNumberOfCorners())
-    return -1;
-
-  if (iC + 1 < getNumberOfCorners() && _coordIndex[iC+1] != -1)
-    return _coordIndex[iC+1];
-
-  // backward
-  int iC1 = iC;
-  while (iC1 >= 0 && _face[iC1] != -1) {
-    --iC1;
-  }
-  return _coordIndex[iC1+1];
+template<class T>
+T HalfEdgesT<T>::getDst(const T iC) const {
+  const T iCn = getNext(iC);
+  return (iCn==IndexTraits<T>::none)?iCn:_coordIndex[iCn];
 }
 
-// half-edge method next()
-int HalfEdges::getNext(const int iC) const {
-  if (iC < 0 || iC >= getNumberOfCorners())
-    return -1;
-
-  // if iC is the last corner of its face, use the face size
-  // stored in _twin[iC+1] to locate the first corner of the face
-  if (_face[iC+1] != -1) {
-    return iC+1;
-  }
-  int iC1 = iC;
-  while (iC1 >= 0 && _face[iC1] != -1) {
-    --iC1;
-  }
-  return iC1+1;
-
+// half-edge method next(); the first corner of the face follows the
+// last one
+template<class T>
+T HalfEdgesT<T>::getNext(const T iC) const {
+  if (!IndexTraits<T>::inRange(iC,getNumberOfCorners()))
+    return IndexTraits<T>::none;
+  const T iF = _face[iC];
+  if (iF == IndexTraits<T>::none)
+    return IndexTraits<T>::none;
+  // the face separator is at _faceFirstCorner[iF+1]-1
+  return (iC+2 < _faceFirstCorner[iF+1]) ? iC+1 : _faceFirstCorner[iF];
 }
 
-// half-edge method prev()
-int HalfEdges::getPrev(const int iC) const {
-  if (iC < 0 || iC >= getNumberOfCorners())
-    return -1;
-
-  // if iC is the first corner of its face, since the face size is
-  // stored at the end of the face in the _twin array, you will have
-  // to search forward for the last corner of the face; you can use
-  // the fact that all the faces have at least 3 corners to start the
-  // search for the face separator at iC+3
-
-  if (iC > 0 && _face[iC-1] != -1) {
-    return iC-1;
-  }
-
-  int iC1 = iC;
-  while (iC1 < _coordIndex.size() && _face[iC1] != -1) {
-    ++iC1;
-  }
-
-  return iC1-1;
+// half-edge method prev(); the last corner of the face precedes the
+// first one
+template<class T>
+T HalfEdgesT<T>::getPrev(const T iC) const {
+  if (!IndexTraits<T>::inRange(iC,getNumberOfCorners()))
+    return IndexTraits<T>::none;
+  const T iF = _face[iC];
+  if (iF == IndexTraits<T>::none)
+    return IndexTraits<T>::none;
+  return (iC > _faceFirstCorner[iF]) ? iC-1 : _faceFirstCorner[iF+1]-2;
 }
 
-int HalfEdges::getTwin(const int iC) const {
-  if (iC < 0 || iC >= getNumberOfCorners())
-    return -1;
+template<class T>
+T HalfEdgesT<T>::getTwin(const T iC) const {
+  if (!IndexTraits<T>::inRange(iC,getNumberOfCorners()))
+    return IndexTraits<T>::none;
   return _twin[iC];
 }
 
 // represent the half edge as an array of lists, with one list
 // associated with each edge
-int HalfEdges::getNumberOfEdgeHalfEdges(const int iE) const {
-  if (iE < 0 || iE >= getNumberOfEdges())
+template<class T>
+T HalfEdgesT<T>::getNumberOfEdgeHalfEdges(const T iE) const {
+  if (!IndexTraits<T>::inRange(iE,getNumberOfEdges()))
     return 0;
 
   return _firstCornerEdge[iE+1] - _firstCornerEdge[iE];
 }
 
-int HalfEdges::getEdgeHalfEdge(const int iE, const int j) const {
+template<class T>
+T HalfEdgesT<T>::getEdgeHalfEdge(const T iE, const T j) const {
 
-  if (iE < 0 || iE >= getNumberOfEdges())
-    return -1;
+  if (!IndexTraits<T>::inRange(iE,getNumberOfEdges()))
+    return IndexTraits<T>::none;
 
-  if (j < 0 || j >= getNumberOfEdgeHalfEdges(iE))
-    return -1;
+  if (!IndexTraits<T>::inRange(j,getNumberOfEdgeHalfEdges(iE)))
+    return IndexTraits<T>::none;
 
   return _cornerEdge[_firstCornerEdge[iE]+j];
 }
+
+template<class T>
+T HalfEdgesT<T>::getNumberOfFaces() const {
+  return static_cast<T>(_faceFirstCorner.size())-1;
+}
+
+template<class T>
+T HalfEdgesT<T>::getFaceSize(const T iF) const {
+  if (!IndexTraits<T>::inRange(iF,getNumberOfFaces()))
+    return 0;
+  return _faceFirstCorner[iF+1]-_faceFirstCorner[iF]-1;
+}
+
+template<class T>
+T HalfEdgesT<T>::getFaceFirstCorner(const T iF) const {
+  if (!IndexTraits<T>::inRange(iF,getNumberOfFaces()))
+    return IndexTraits<T>::none;
+  return _faceFirstCorner[iF];
+}
+
+template<class T>
+std::span<const T> HalfEdgesT<T>::getFaceVertices(const T iF) const {
+  if (!IndexTraits<T>::inRange(iF,getNumberOfFaces()))
+    return {};
+  return std::span<const T>(_coordIndex).subspan(_faceFirstCorner[iF],getFaceSize(iF));
+}
+
+template<class T>
+std::span<const T> HalfEdgesT<T>::getEdgeHalfEdges(const T iE) const {
+  if (!IndexTraits<T>::inRange(iE,getNumberOfEdges()))
+    return {};
+  return std::span<const T>(_cornerEdge).subspan(_firstCornerEdge[iE],getNumberOfEdgeHalfEdges(iE));
+}
+
+template class HalfEdgesT<int>;
+template class HalfEdgesT<uint32_t>;
+template class HalfEdgesT<int64_t>;
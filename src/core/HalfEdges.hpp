@@ -42,14 +42,26 @@
 // DAMAGE.
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "Edges.hpp"
 
-class HalfEdges : public Edges {
+template<class T>
+class HalfEdgesT : public EdgesT<T> {
 
 public:
 
+  // T is the index type (see IndexTraits.hpp); the values returned as
+  // -1 below are IndexTraits<T>::none, which is also the value of the
+  // face separators in coordIndex
+
+  using EdgesT<T>::getNumberOfVertices;
+  using EdgesT<T>::getNumberOfEdges;
+  using EdgesT<T>::getEdge;
+  using EdgesT<T>::getVertex0;
+  using EdgesT<T>::getVertex1;
+
   // methods inherited from Edges
   //
   // int     getNumberOfVertices()                     const;
@@ -58,14 +70,22 @@ public:
   // int     getVertex0(const int iE)                  const;
   // int     getVertex1(const int iE)                  const;
 
-  // constructor performs most of the work
-  HalfEdges(int nV, const std::vector<int>& coordIndex);
+  // - constructor performs most of the work
+  // - if Parallel::getNumberOfThreads()>1 the half-edges are grouped
+  //   by edge with a parallel radix sort instead of the three serial
+  //   passes over coordIndex; the results are identical
+  // - for the signed index types every coordIndex value must satisfy
+  //   -1<=iV<nV, and for the unsigned ones iV<nV or iV==none;
+  //   otherwise the constructor throws std::runtime_error
+  // - the parallel construction needs vertex indices of at most 31
+  //   bits; the serial one is used for larger meshes
+  HalfEdgesT(T nV, const std::vector<T>& coordIndex);
 
   /**
    * returns the number of elements of the coordIndex array
    *
    **/
-  int getNumberOfCorners() const;
+  T getNumberOfCorners() const;
 
   /**
    * returns the index of the face containing the half edge corresponding to the corner index iC;
@@ -73,7 +93,7 @@ public:
    *
    * @param iC: corner index
    */
-  int getFace(int iC) const;
+  T getFace(T iC) const;
 
   /**
    * half-edges are in one-to-one correspondence with the corners of a mesh,
@@ -81,15 +101,17 @@ public:
    * if the corner index iC is out of the range 0<=iC<coordIndex.size(), or coordIndex[iC]<0, these methods return -1;
    *
   **/
-  int getSrc(int iC) const;
-  int getDst(int iC) const;
+  T getSrc(T iC) const;
+  T getDst(T iC) const;
 
   /**
    * the mesh faces define loops of half edges; these two methods can be used to move back and forth along these loops;
+   * they run in constant time, using the first corner of the face containing iC;
+   * if the corner index is out of range, or it corresponds to a face separator, these methods return -1
    *
   */
-  int getNext(int iC) const;
-  int getPrev(int iC) const;
+  T getNext(T iC) const;
+  T getPrev(T iC) const;
 
   /**
    * a regular edge of a mesh has exactly two incident half-edges;
@@ -97,14 +119,14 @@ public:
    * this method returns the other half-edge; otherwise it returns -1
    *
    */
-  int getTwin(int iC) const;
+  T getTwin(T iC) const;
 
   /**
    * if the edge index iE is in range, this method returns the number of half-edges incident to the given edge;
    * otherwise it returns 0
    *
    */
-  int getNumberOfEdgeHalfEdges(int iE) const;
+  T getNumberOfEdgeHalfEdges(T iE) const;
 
   /**
    * if the edge index iE is in range, and 0<=j<getNumberOfEdgeHalfEdges(iE),
@@ -112,24 +134,73 @@ public:
    *
    */
 
-  int getEdgeHalfEdge(int iE, int j) const;
+  T getEdgeHalfEdge(T iE, T j) const;
+
+  /**
+   * returns the corners of all the half-edges incident to the edge iE, in the same order as getEdgeHalfEdge(iE,j);
+   * the span is empty if the edge index is out of range
+   *
+   */
+  std::span<const T> getEdgeHalfEdges(T iE) const;
+
+  /**
+   * number of faces, i.e., number of -1 separators in the coordIndex array;
+   * the corners after the last separator, if any, do not belong to any face
+   *
+   */
+  T getNumberOfFaces() const;
+
+  /**
+   * if the face index iF is in range, these methods return the number of corners of the face,
+   * and the index of its first corner; the corners of the face are
+   * getFaceFirstCorner(iF)<=iC<getFaceFirstCorner(iF)+getFaceSize(iF);
+   * otherwise they return 0 and -1
+   *
+   */
+  T getFaceSize(T iF) const;
+  T getFaceFirstCorner(T iF) const;
+
+  /**
+   * returns the vertex indices of the corners of the face iF, as a view into the coordIndex array;
+   * the span is empty if the face index is out of range
+   *
+   * for(int iF=0;iF<mesh.getNumberOfFaces();iF++)
+   *   for(int iV : mesh.getFaceVertices(iF))
+   *     // ...
+   *
+   */
+  std::span<const T> getFaceVertices(T iF) const;
 
 protected:
 
+  void _buildSerial();
+  void _buildSorted();
+
   // reference to the coordIndex passed as argument
-  const std::vector<int>& _coordIndex;
+  const std::vector<T>& _coordIndex;
 
   // - consider these private variables are just a hint
   // - feel free to use different private variables
 
   // array of twin corners
-    std::vector<int> _twin;
+    std::vector<T> _twin;
 
   // mapping from corners to faces
-    std::vector<int> _face;
+    std::vector<T> _face;
+
+  // mapping from faces to corners: face iF comprises the corners
+  // _faceFirstCorner[iF]<=iC<_faceFirstCorner[iF+1]-1, followed by its
+  // separator; the size is equal to the number of faces plus one
+    std::vector<T> _faceFirstCorner;
 
   // the half-edge to edge incidence relation is represented as an array of arrays
-    std::vector<int> _firstCornerEdge;
-    std::vector<int> _cornerEdge;
+    std::vector<T> _firstCornerEdge;
+    std::vector<T> _cornerEdge;
 
 };
+
+extern template class HalfEdgesT<int>;
+extern template class HalfEdgesT<uint32_t>;
+extern template class HalfEdgesT<int64_t>;
+
+using HalfEdges = HalfEdgesT<int>;
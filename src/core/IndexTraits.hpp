@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// IndexTraits.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef _INDEX_TRAITS_HPP_
+#define _INDEX_TRAITS_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// - the topology classes EdgesT, GraphT, HalfEdgesT, PolygonMeshT,
+//   PartitionT, ConcurrentPartitionT and MeshTopologySummaryT are
+//   templates on the integer type used to store vertex, edge, corner
+//   and face indices; they are explicitly instantiated for int,
+//   uint32_t and int64_t, and the classes Edges, Graph, HalfEdges,
+//   PolygonMesh, Partition, ConcurrentPartition and
+//   MeshTopologySummary are their int instantiations
+// - uint32_t covers meshes with up to 2^32-2 corners using the same
+//   memory as int, and int64_t covers larger ones
+
+template<class T>
+struct IndexTraits {
+
+  static_assert(std::is_integral_v<T> && (sizeof(T)==4 || sizeof(T)==8),
+                "the index type must be a 32 or 64 bit integer");
+
+  using Unsigned = std::make_unsigned_t<T>;
+
+  // - value returned by the methods for missing or invalid indices,
+  //   and value of the face separators in coordIndex arrays
+  // - it is -1 for the signed types, and the largest value for the
+  //   unsigned ones, which is what -1 converts to
+  static constexpr T none = static_cast<T>(-1);
+
+  // returns true if 0<=i<n; a single unsigned comparison
+  static constexpr bool inRange(const T i, const T n) {
+    return static_cast<Unsigned>(i)<static_cast<Unsigned>(n);
+  }
+
+  // - pair of non-negative indices (hi,lo) packed into a key which
+  //   sorts in (hi,lo) lexicographic order
+  // - a single 64 bit word for 32 bit indices, and a pair of words
+  //   for 64 bit indices
+  using Key = std::conditional_t<(sizeof(T)<=4),uint64_t,std::pair<uint64_t,uint64_t>>;
+
+  static constexpr Key makeKey(const T hi, const T lo) {
+    if constexpr (sizeof(T)<=4)
+      return (static_cast<uint64_t>(static_cast<Unsigned>(hi))<<32)|
+        static_cast<uint64_t>(static_cast<Unsigned>(lo));
+    else
+      return Key(static_cast<uint64_t>(hi),static_cast<uint64_t>(lo));
+  }
+
+  static constexpr T keyHi(const Key& key) {
+    if constexpr (sizeof(T)<=4)
+      return static_cast<T>(static_cast<Unsigned>(key>>32));
+    else
+      return static_cast<T>(key.first);
+  }
+
+  static constexpr T keyLo(const Key& key) {
+    if constexpr (sizeof(T)<=4)
+      return static_cast<T>(static_cast<Unsigned>(key));
+    else
+      return static_cast<T>(key.second);
+  }
+
+};
+
+#endif // _INDEX_TRAITS_HPP_
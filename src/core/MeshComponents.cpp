@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// MeshComponents.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "MeshComponents.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+#include <util/Parallel.hpp>
+#include <wrl/IndexedFaceSet.hpp>
+
+#include "ConcurrentPartition.hpp"
+#include "IndexTraits.hpp"
+#include "PolygonMesh.hpp"
+
+namespace {
+
+  // reverses the corners of the faces iF of index for which flip[iF]
+  // is set; the faces are delimited by negative values for the signed
+  // types, and by the largest value for the unsigned ones
+  template<class I>
+  void reverseFaces(std::vector<I>& index, const std::vector<uint8_t>& flip) {
+    const size_t nF = flip.size();
+    size_t iF = 0, i0 = 0;
+    for(size_t i=0;i<index.size() && iF<nF;i++) {
+      bool isSeparator;
+      if constexpr (std::is_signed_v<I>)
+        isSeparator = index[i]<0;
+      else
+        isSeparator = index[i]==static_cast<I>(-1);
+      if(!isSeparator) continue;
+      if(flip[iF])
+        std::reverse(index.begin()+i0,index.begin()+i);
+      iF++;
+      i0 = i+1;
+    }
+  }
+
+}
+
+template<class T>
+MeshComponentsT<T>::MeshComponentsT():
+  _nF(0),
+  _nK(0),
+  _nKNonOrientable(0),
+  _nFFlipped(0),
+  _faceComponent(),
+  _faceFlip(),
+  _componentFirstFace(),
+  _componentFace(),
+  _componentOrientable() {
+}
+
+template<class T>
+void MeshComponentsT<T>::build(const PolygonMeshT<T>& mesh) {
+
+  const T nE = mesh.getNumberOfEdges();
+  _nF = mesh.getNumberOfFaces();
+
+  // 1) join the two faces of every regular edge
+  ConcurrentPartitionT<T> partition(_nF);
+  Parallel::forChunks(nE,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    for (T iE = static_cast<T>(begin); iE < static_cast<T>(end); ++iE) {
+      if (mesh.getNumberOfEdgeHalfEdges(iE) == 2)
+        partition.join(mesh.getFace(mesh.getEdgeHalfEdge(iE, 0)),
+                       mesh.getFace(mesh.getEdgeHalfEdge(iE, 1)));
+    }
+  });
+  _faceComponent = partition.compactLabels();
+  _nK = partition.getNumberOfParts();
+
+  // 2) list the faces of each component, in increasing order
+  _componentFirstFace.assign(_nK + 1, 0);
+  for (T iF = 0; iF < _nF; ++iF)
+    _componentFirstFace[_faceComponent[iF] + 1]++;
+  for (T iK = 0; iK < _nK; ++iK)
+    _componentFirstFace[iK + 1] += _componentFirstFace[iK];
+  _componentFace.resize(_nF);
+  std::vector<T> next(_componentFirstFace.begin(), _componentFirstFace.end() - 1);
+  for (T iF = 0; iF < _nF; ++iF)
+    _componentFace[next[_faceComponent[iF]]++] = iF;
+
+  // 3) orient each component by a breadth-first traversal of the
+  //    twins, starting from its smallest face; two faces sharing a
+  //    regular edge are consistently oriented if the two half edges
+  //    have different sources; the components have disjoint sets of
+  //    faces, so they can be traversed concurrently
+  const uint8_t unvisited = 2;
+  _faceFlip.assign(_nF, unvisited);
+  _componentOrientable.assign(_nK, 1);
+  std::vector<T> nKFlipped(_nK, 0);
+  Parallel::forChunks(_nK,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    std::vector<T> queue;
+    for (T iK = static_cast<T>(begin); iK < static_cast<T>(end); ++iK) {
+      queue.clear();
+      queue.push_back(_componentFace[_componentFirstFace[iK]]);
+      _faceFlip[queue[0]] = 0;
+      T nFlipped = 0;
+      for (size_t iQ = 0; iQ < queue.size(); ++iQ) {
+        const T iF = queue[iQ];
+        const uint8_t flipF = _faceFlip[iF];
+        const T iC0 = mesh.getFaceFirstCorner(iF);
+        const T iC1 = iC0 + mesh.getFaceSize(iF);
+        for (T iC = iC0; iC < iC1; ++iC) {
+          const T iT = mesh.getTwin(iC);
+          if (iT == IndexTraits<T>::none)
+            continue;
+          const T iG = mesh.getFace(iT);
+          const uint8_t flipG = flipF ^ ((mesh.getSrc(iC) == mesh.getSrc(iT)) ? 1 : 0);
+          if (_faceFlip[iG] == unvisited) {
+            _faceFlip[iG] = flipG;
+            nFlipped += flipG;
+            queue.push_back(iG);
+          } else if (_faceFlip[iG] != flipG) {
+            _componentOrientable[iK] = 0;
+          }
+        }
+      }
+      nKFlipped[iK] = nFlipped;
+    }
+  });
+
+  // 4) keep the orientation of the majority of the faces of each
+  //    component
+  _nKNonOrientable = 0;
+  for (T iK = 0; iK < _nK; ++iK) {
+    if (!_componentOrientable[iK])
+      _nKNonOrientable++;
+    if (2 * nKFlipped[iK] > getComponentSize(iK)) {
+      for (const T iF : getComponentFaces(iK))
+        _faceFlip[iF] ^= 1;
+    }
+  }
+  _nFFlipped = static_cast<T>(std::count(_faceFlip.begin(), _faceFlip.end(), 1));
+}
+
+template<class T>
+T MeshComponentsT<T>::getFaceComponent(const T iF) const {
+  return IndexTraits<T>::inRange(iF,_nF)?_faceComponent[iF]:IndexTraits<T>::none;
+}
+
+template<class T>
+bool MeshComponentsT<T>::getFaceFlip(const T iF) const {
+  return IndexTraits<T>::inRange(iF,_nF) && _faceFlip[iF]!=0;
+}
+
+template<class T>
+T MeshComponentsT<T>::getComponentSize(const T iK) const {
+  if (!IndexTraits<T>::inRange(iK,_nK))
+    return 0;
+  return _componentFirstFace[iK + 1] - _componentFirstFace[iK];
+}
+
+template<class T>
+std::span<const T> MeshComponentsT<T>::getComponentFaces(const T iK) const {
+  const T n = getComponentSize(iK);
+  if (n == 0)
+    return {};
+  return {_componentFace.data() + _componentFirstFace[iK], static_cast<size_t>(n)};
+}
+
+template<class T>
+bool MeshComponentsT<T>::isComponentOrientable(const T iK) const {
+  return IndexTraits<T>::inRange(iK,_nK) && _componentOrientable[iK]!=0;
+}
+
+template<class T>
+void MeshComponentsT<T>::orientFaces(std::vector<T>& cornerIndex) const {
+  if (_nFFlipped > 0)
+    reverseFaces(cornerIndex, _faceFlip);
+}
+
+template<class T>
+void MeshComponentsT<T>::orientFaces(IndexedFaceSet& ifs) const {
+  if (_nFFlipped == 0)
+    return;
+  reverseFaces(ifs.getCoordIndex(), _faceFlip);
+  if (ifs.getNormalBinding() == IndexedFaceSet::PB_PER_CORNER)
+    reverseFaces(ifs.getNormalIndex(), _faceFlip);
+  if (ifs.getColorBinding() == IndexedFaceSet::PB_PER_CORNER)
+    reverseFaces(ifs.getColorIndex(), _faceFlip);
+  if (ifs.getTexCoordBinding() == IndexedFaceSet::PB_PER_CORNER)
+    reverseFaces(ifs.getTexCoordIndex(), _faceFlip);
+}
+
+template class MeshComponentsT<int>;
+template class MeshComponentsT<uint32_t>;
+template class MeshComponentsT<int64_t>;
@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// MeshComponents.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef _MESH_COMPONENTS_HPP_
+#define _MESH_COMPONENTS_HPP_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class IndexedFaceSet;
+template<class T> class PolygonMeshT;
+
+template<class T>
+class MeshComponentsT {
+
+  // this class computes the connected components of the faces of a
+  // PolygonMesh, and a consistent orientation of each component
+  //
+  // - two faces are connected if they share a regular edge; faces
+  //   which only share singular edges or vertices end up in different
+  //   components
+  // - the faces are joined with a ConcurrentPartition, with the
+  //   regular edges split among Parallel::getNumberOfThreads()
+  //   threads; the components are numbered in increasing order of
+  //   their smallest face, so the result does not depend on the
+  //   number of threads
+  // - each component is then oriented by a breadth-first traversal of
+  //   the twin half-edges, starting from its smallest face; the
+  //   components are traversed concurrently
+  // - a component is non-orientable if some regular edge cannot be
+  //   made consistent; its faces are still oriented consistently
+  //   along the traversal tree, but some of its edges remain
+  //   inconsistent
+  // - if more than half the faces of a component have to be flipped,
+  //   the flips of the whole component are inverted, so that the
+  //   orientation of the majority of the faces is preserved
+  // - T is the index type (see IndexTraits.hpp), and the values
+  //   returned as -1 below are IndexTraits<T>::none
+
+public:
+
+  MeshComponentsT();
+
+  // compute the components and their orientation; it requires the
+  // half edges of the mesh to be built
+  void build(const PolygonMeshT<T>& mesh);
+
+  T getNumberOfFaces()                   const { return _nF; }
+  T getNumberOfComponents()              const { return _nK; }
+  T getNumberOfNonOrientableComponents() const { return _nKNonOrientable; }
+  T getNumberOfFlippedFaces()            const { return _nFFlipped; }
+
+  bool isOrientable()                    const { return _nKNonOrientable==0; }
+
+  // component of face iF; -1 if iF is out of range
+  T getFaceComponent(T iF) const;
+
+  // true if face iF has to be reversed to orient its component
+  // consistently; false if iF is out of range
+  bool getFaceFlip(T iF) const;
+
+  // faces of component iK, in increasing order; the span is empty if
+  // iK is out of range
+  T getComponentSize(T iK) const;
+  std::span<const T> getComponentFaces(T iK) const;
+
+  // false if iK is out of range
+  bool isComponentOrientable(T iK) const;
+
+  // - reverses the order of the corners of the flipped faces of an
+  //   array with the same face structure as the coordIndex array the
+  //   mesh was built from, i.e. the coordIndex itself, or a per-corner
+  //   normalIndex, colorIndex, or texCoordIndex; it runs in linear time
+  // - the corners after the last face separator, if any, are left
+  //   unchanged
+  void orientFaces(std::vector<T>& cornerIndex) const;
+
+  // - applies orientFaces() to the coordIndex of ifs, and to its
+  //   normalIndex, colorIndex, and texCoordIndex if their binding is
+  //   per corner
+  // - normals stored per vertex or per face are not inverted, and
+  //   should be recomputed after the faces are oriented
+  // - ifs must be the IndexedFaceSet the mesh was built from
+  void orientFaces(IndexedFaceSet& ifs) const;
+
+private:
+
+  T _nF;
+  T _nK;
+  T _nKNonOrientable;
+  T _nFFlipped;
+
+  std::vector<T>       _faceComponent;
+  std::vector<uint8_t> _faceFlip;
+
+  // CSR lists of the faces of each component
+  std::vector<T>       _componentFirstFace;
+  std::vector<T>       _componentFace;
+
+  std::vector<uint8_t> _componentOrientable;
+};
+
+extern template class MeshComponentsT<int>;
+extern template class MeshComponentsT<uint32_t>;
+extern template class MeshComponentsT<int64_t>;
+
+using MeshComponents = MeshComponentsT<int>;
+
+#endif // _MESH_COMPONENTS_HPP_
@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// MeshTopologySummary.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "MeshTopologySummary.hpp"
+#include "PolygonMesh.hpp"
+
+template<class T>
+MeshTopologySummaryT<T>::MeshTopologySummaryT():
+  _nV(0),
+  _nE(0),
+  _nF(0),
+  _nC(0),
+  _nVBoundary(0),
+  _nVSingular(0),
+  _nEBoundary(0),
+  _nERegular(0),
+  _nESingular(0),
+  _edgeClass(),
+  _vertexClass() {
+}
+
+template<class T>
+void MeshTopologySummaryT<T>::build(const PolygonMeshT<T>& mesh) {
+
+  _nV = mesh.getNumberOfVertices();
+  _nE = mesh.getNumberOfEdges();
+  _nF = mesh.getNumberOfFaces();
+  _nC = mesh.getNumberOfCorners();
+
+  _nEBoundary = _nERegular = _nESingular = 0;
+  _nVBoundary = _nVSingular = 0;
+
+  _edgeClass.assign(_nE, 0);
+  _vertexClass.assign(_nV, 0);
+
+  // 1) classify the edges by number of incident faces, and label the
+  //    two ends of every boundary edge as boundary vertices
+  for (T iE = 0; iE < _nE; ++iE) {
+    const T nF = mesh.getNumberOfEdgeHalfEdges(iE);
+    if (nF == 1) {
+      _edgeClass[iE] = BOUNDARY;
+      _nEBoundary++;
+      _vertexClass[mesh.getVertex0(iE)] = BOUNDARY;
+      _vertexClass[mesh.getVertex1(iE)] = BOUNDARY;
+    } else if (nF == 2) {
+      _edgeClass[iE] = REGULAR;
+      _nERegular++;
+    } else if (nF > 2) {
+      _edgeClass[iE] = SINGULAR;
+      _nESingular++;
+    }
+  }
+
+  // 2) classify the vertices by number of corner parts
+  for (T iV = 0; iV < _nV; ++iV) {
+    if (_vertexClass[iV] & BOUNDARY)
+      _nVBoundary++;
+    if (mesh.getNumberOfVertexParts(iV) > 1) {
+      _vertexClass[iV] |= SINGULAR;
+      _nVSingular++;
+    } else {
+      _vertexClass[iV] |= REGULAR;
+    }
+  }
+}
+
+template<class T>
+uint8_t MeshTopologySummaryT<T>::getEdgeClass(const T iE) const {
+  return IndexTraits<T>::inRange(iE,_nE)?_edgeClass[iE]:0;
+}
+
+template<class T>
+uint8_t MeshTopologySummaryT<T>::getVertexClass(const T iV) const {
+  return IndexTraits<T>::inRange(iV,_nV)?_vertexClass[iV]:0;
+}
+
+template class MeshTopologySummaryT<int>;
+template class MeshTopologySummaryT<uint32_t>;
+template class MeshTopologySummaryT<int64_t>;
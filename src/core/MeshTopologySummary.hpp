@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// MeshTopologySummary.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef _MESH_TOPOLOGY_SUMMARY_HPP_
+#define _MESH_TOPOLOGY_SUMMARY_HPP_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+template<class T> class PolygonMeshT;
+
+template<class T>
+class MeshTopologySummaryT {
+
+  // this class classifies the edges and vertices of a PolygonMesh
+  // once, when the mesh is constructed, so that the classification
+  // queries and the global counts can be answered in constant time
+  //
+  // - the class of each edge and of each vertex is packed into one
+  //   byte of flags
+  // - an edge is BOUNDARY, REGULAR, or SINGULAR if it has 1, 2, or
+  //   more than 2 incident faces; an edge with no incident faces
+  //   gets no flags
+  // - a vertex is BOUNDARY if it is the end of a boundary edge, and
+  //   it is either REGULAR or SINGULAR depending on whether it has at
+  //   most one or more than one corner part
+
+public:
+
+  static const uint8_t BOUNDARY = 0x01;
+  static const uint8_t REGULAR  = 0x02;
+  static const uint8_t SINGULAR = 0x04;
+
+  MeshTopologySummaryT();
+
+  // classify all the edges and vertices of the mesh; it requires the
+  // edges, half edges, and corner parts of the mesh to be built
+  void build(const PolygonMeshT<T>& mesh);
+
+  T getNumberOfVertices()         const { return _nV; }
+  T getNumberOfEdges()            const { return _nE; }
+  T getNumberOfFaces()            const { return _nF; }
+  T getNumberOfCorners()          const { return _nC; }
+
+  T getNumberOfBoundaryVertices() const { return _nVBoundary; }
+  T getNumberOfInternalVertices() const { return _nV-_nVBoundary; }
+  T getNumberOfRegularVertices()  const { return _nV-_nVSingular; }
+  T getNumberOfSingularVertices() const { return _nVSingular; }
+
+  T getNumberOfBoundaryEdges()    const { return _nEBoundary; }
+  T getNumberOfRegularEdges()     const { return _nERegular; }
+  T getNumberOfSingularEdges()    const { return _nESingular; }
+  T getNumberOfOtherEdges()       const { return _nE-_nEBoundary-_nERegular-_nESingular; }
+
+  // V-E+F
+  int64_t getEulerCharacteristic()  const {
+    return static_cast<int64_t>(_nV)-static_cast<int64_t>(_nE)+static_cast<int64_t>(_nF);
+  }
+
+  bool isRegular()                  const { return _nESingular==0 && _nVSingular==0; }
+  bool hasBoundary()                const { return _nEBoundary>0; }
+
+  // return 0 if the argument is out of range
+  uint8_t getEdgeClass(T iE) const;
+  uint8_t getVertexClass(T iV) const;
+
+  std::span<const uint8_t> getEdgeClasses()   const { return _edgeClass; }
+  std::span<const uint8_t> getVertexClasses() const { return _vertexClass; }
+
+private:
+
+  T _nV;
+  T _nE;
+  T _nF;
+  T _nC;
+  T _nVBoundary;
+  T _nVSingular;
+  T _nEBoundary;
+  T _nERegular;
+  T _nESingular;
+
+  std::vector<uint8_t> _edgeClass;
+  std::vector<uint8_t> _vertexClass;
+};
+
+extern template class MeshTopologySummaryT<int>;
+extern template class MeshTopologySummaryT<uint32_t>;
+extern template class MeshTopologySummaryT<int64_t>;
+
+using MeshTopologySummary = MeshTopologySummaryT<int>;
+
+#endif // _MESH_TOPOLOGY_SUMMARY_HPP_
@@ -40,8 +40,11 @@
 // DAMAGE.
 
 #include "Partition.hpp"
+#include "IndexTraits.hpp"
 
-Partition::Partition(const int nElements):
+template<class T>
+PartitionT<T>::PartitionT(const T nElements, const Compression compression):
+  _compression(compression),
   _nParts(0),
   _parent(),
   _size()
@@ -49,31 +52,55 @@ Partition::Partition(const int nElements):
   reset(nElements);
 }
 
-void Partition::reset(const int nElements) {
+template<class T>
+void PartitionT<T>::reset(const T nElements) {
   _nParts = 0;
   _parent.clear();
   _size.clear();
   if(nElements>0) {
     _nParts = nElements;
-    for(int i=0;i<nElements;i++) {
+    for(T i=0;i<nElements;i++) {
       _parent.push_back(i);
       _size.push_back(1);
     }
   }
 }
 
-int Partition::getNumberOfElements() const {
-  return static_cast<int>(_parent.size());
+template<class T>
+typename PartitionT<T>::Compression PartitionT<T>::getCompression() const {
+  return _compression;
 }
 
-int Partition::getNumberOfParts() const {
+template<class T>
+T PartitionT<T>::getNumberOfElements() const {
+  return static_cast<T>(_parent.size());
+}
+
+template<class T>
+T PartitionT<T>::getNumberOfParts() const {
   return _nParts;
 }
 
-int Partition::find(const int i) {
-  if(i<0) return -1;
-  if(i>=getNumberOfElements()) return -1;
-  int Ri,Pj,j;
+template<class T>
+T PartitionT<T>::find(const T i) {
+  if(!IndexTraits<T>::inRange(i,getNumberOfElements())) return IndexTraits<T>::none;
+  T Ri,Pj,j;
+  switch(_compression) {
+  case HALVING:
+    // point every other node of the path to its grandparent
+    for(Ri=i;_parent[Ri]!=Ri;Ri=_parent[Ri])
+      _parent[Ri] = _parent[_parent[Ri]];
+    return Ri;
+  case SPLITTING:
+    // point every node of the path to its grandparent
+    for(Ri=i;_parent[Ri]!=Ri;Ri=Pj) {
+      Pj = _parent[Ri];
+      _parent[Ri] = _parent[Pj];
+    }
+    return Ri;
+  default:
+    break;
+  }
   // traverse path and find root node
   for(Ri=i;_parent[Ri]!=Ri;Ri=_parent[Ri]);
   // compress the path:
@@ -83,11 +110,50 @@ int Partition::find(const int i) {
   return Ri;
 }
 
-int Partition::join(const int i, const int j) {
-  int Rij = -1;
-  int Ri = find(i);
-  int Rj = find(j);
-  if(Ri>=0 && Rj>=0 && (Rij=Ri)!=Rj) {
+template<class T>
+T PartitionT<T>::findNoCompress(const T i) const {
+  if(!IndexTraits<T>::inRange(i,getNumberOfElements())) return IndexTraits<T>::none;
+  T Ri;
+  for(Ri=i;_parent[Ri]!=Ri;Ri=_parent[Ri]);
+  return Ri;
+}
+
+template<class T>
+bool PartitionT<T>::findAll(std::span<T> root) {
+  const T n = getNumberOfElements();
+  if(root.size()!=static_cast<size_t>(n)) return false;
+  // - elements visited earlier keep pointing to their roots, since
+  //   find() only moves links towards the root; the paths shortened
+  //   by find() make the later ones cheaper
+  for(T i=0;i<n;i++)
+    root[i] = _parent[i] = find(i);
+  return true;
+}
+
+template<class T>
+vector<T> PartitionT<T>::compactLabels() {
+  constexpr T none = IndexTraits<T>::none;
+  const T n = getNumberOfElements();
+  vector<T> label(n);
+  findAll(label);
+  // the first element of each part visited is its smallest one
+  vector<T> rootLabel(n,none);
+  T nLabels = 0;
+  for(T i=0;i<n;i++) {
+    T& l = rootLabel[label[i]];
+    if(l==none) l = nLabels++;
+    label[i] = l;
+  }
+  return label;
+}
+
+template<class T>
+T PartitionT<T>::join(const T i, const T j) {
+  constexpr T none = IndexTraits<T>::none;
+  T Rij = none;
+  T Ri = find(i);
+  T Rj = find(j);
+  if(Ri!=none && Rj!=none && (Rij=Ri)!=Rj) {
     _nParts--;
     if(_size[Ri]>=_size[Rj]) {
       // make Ri the root of the joined part
@@ -100,7 +166,12 @@ int Partition::join(const int i, const int j) {
   return Rij;
 }
 
-int Partition::getSize(const int i) const {
-  return (i<0 || i>=static_cast<int>(_parent.size()))?0:_size[i];
+template<class T>
+T PartitionT<T>::getSize(const T i) const {
+  return IndexTraits<T>::inRange(i,getNumberOfElements())?_size[findNoCompress(i)]:0;
 
 }
+
+template class PartitionT<int>;
+template class PartitionT<uint32_t>;
+template class PartitionT<int64_t>;
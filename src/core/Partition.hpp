@@ -46,43 +46,92 @@
 #ifndef _PARTITION_HPP_
 #define _PARTITION_HPP_
 
+#include <cstdint>
+#include <span>
 #include <vector>
 
 using namespace std;
 
-class Partition {
+template<class T>
+class PartitionT {
 
-  // this class implements the Fast Union-Find data structure
+  // this class implements the Fast Union-Find data structure; T is
+  // the index type (see IndexTraits.hpp), and the values returned as
+  // -1 below are IndexTraits<T>::none
+  //
+  // - join() links the root of the smaller part to the root of the
+  //   larger one (union by size)
+  // - find() shortens the path it traverses in one of three ways,
+  //   selected when the partition is constructed:
+  //   COMPRESSION : a second pass points every node of the path to
+  //                 the root
+  //   HALVING     : every other node of the path is pointed to its
+  //                 grandparent, in a single pass
+  //   SPLITTING   : every node of the path is pointed to its
+  //                 grandparent, in a single pass
+  //   all of them give the same parts and the same amortized bounds;
+  //   COMPRESSION is the default (see dgpBench)
+  // - once all the joins are done, the const methods can be called
+  //   concurrently from multiple threads, as long as find(), join(),
+  //   findAll(), compactLabels() and reset() are not; findAll() or
+  //   compactLabels() point every element directly to its root, after
+  //   which findNoCompress() runs in constant time
   //
   // Reference
   // https://en.wikipedia.org/wiki/Disjoint-set_data_structure
   
 public:
 
+  enum Compression {
+    COMPRESSION = 0,
+    HALVING,
+    SPLITTING
+  };
+
   // create a partition of the N elements {0,1,2,...,N-1} where
   // every element is a singleton {0},{1},{2},...,{N-1}
-  explicit Partition(int nElements);
+  explicit PartitionT(T nElements, Compression compression=COMPRESSION);
+
+  // returns the path shortening method used by find()
+  Compression getCompression() const;
 
   // delete the current partition and create a new partition of the N
   // elements {0,1,2,...,N-1} where every element is a singleton
   // {0},{1},{2},...,{N-1}; the number of elements N can be different
   // from the one previously set by the constructor or by a previous
   // call to this method
-  virtual void reset(int nElements);
+  virtual void reset(T nElements);
 
   // returns the current number of elements; i.e. the value of the
   // parameter N passed to the constructor or to the reset(N) method 
-  int     getNumberOfElements()          const;
+  T       getNumberOfElements()          const;
 
   // returns the current number of parts; immediately after
   // constructed or reset, the the number of parts should be equal to
   // the number of elements because each element becomes a singleton
-  int     getNumberOfParts()             const;
+  T       getNumberOfParts()             const;
 
   // the class assigns each part a unique non-negative ID number; this
   // method return the part ID number of the part containing element i;
   // if the element index is out of range this method returns -1
-  int     find(int i);
+  T       find(T i);
+
+  // returns the same part ID as find(i), without modifying the paths
+  T       findNoCompress(T i)            const;
+
+  // - sets root[i]=find(i) for every element i, in one pass in
+  //   increasing order, and points every element directly to its
+  //   root
+  // - returns false, without doing anything, if the size of root is
+  //   not equal to getNumberOfElements()
+  bool    findAll(std::span<T> root);
+
+  // - returns an array of size getNumberOfElements() which assigns
+  //   each element a part label in the range 0<=label<getNumberOfParts();
+  //   the parts are labeled in increasing order of their smallest
+  //   element, as ConcurrentPartition::compactLabels() does
+  // - it also points every element directly to its root
+  vector<T> compactLabels();
 
   // if elements i and j belong to the same part, this method returns
   // the ID of the part containing the two elements; otherwise, the
@@ -92,18 +141,25 @@ public:
   // IDs of the original two parts; the old IDs are not longer valid;
   // if either one of the two element indices is out of range this
   // method returns -1
-  virtual int join(int i, int j);
+  virtual T join(T i, T j);
 
   // returns the number of elements in the part containing the element
   // i; if the element index is out of range this method returns 0
-  int getSize(int i)           const;
+  T getSize(T i)           const;
   
 protected: // so that they accesible to SplittablePartition methods
 
-  int         _nParts;
-  vector<int> _parent;
-  vector<int> _size;
+  Compression _compression;
+  T         _nParts;
+  vector<T> _parent;
+  vector<T> _size;
 
 };
 
+extern template class PartitionT<int>;
+extern template class PartitionT<uint32_t>;
+extern template class PartitionT<int64_t>;
+
+using Partition = PartitionT<int>;
+
 #endif /* _PARTITION_HPP_ */
@@ -41,66 +41,105 @@
 
 #include "PolygonMesh.hpp"
 
-#include <set>
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+
+#include <util/Parallel.hpp>
+
+#include "ConcurrentPartition.hpp"
+
+namespace {
+
+  // - parallel counting sort of the items 0<=i<n by key(i), into the
+  //   CSR arrays first and value; items with key(i)==none are skipped
+  // - the items are counted and scattered with atomic counters, so the
+  //   order of the values of each key is not specified
+  template<class T, class KeyFn, class ValueFn>
+  void countingSort(const T nKeys, const int64_t n, KeyFn key, ValueFn value,
+                    std::vector<T>& first, std::vector<T>& item) {
+    std::vector<std::atomic<T>> pos(nKeys);
+    Parallel::forChunks(n,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; ++i) {
+        const T k = key(i);
+        if (k != IndexTraits<T>::none)
+          pos[k].fetch_add(1,std::memory_order_relaxed);
+      }
+    });
+    first.resize(nKeys + 1);
+    first[0] = 0;
+    for (T k = 0; k < nKeys; ++k) {
+      first[k + 1] = first[k] + pos[k].load(std::memory_order_relaxed);
+      pos[k].store(first[k],std::memory_order_relaxed);
+    }
+    item.resize(first[nKeys]);
+    Parallel::forChunks(n,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; ++i) {
+        const T k = key(i);
+        if (k != IndexTraits<T>::none)
+          item[pos[k].fetch_add(1,std::memory_order_relaxed)] = value(i);
+      }
+    });
+  }
 
-#include "Partition.hpp"
+}
 
-PolygonMesh::PolygonMesh(const int nVertices, const std::vector<int>& coordIndex):
-  HalfEdges(nVertices,coordIndex),
-  _nPartsVertex(),
-  _isBoundaryVertex(),
-  _numberOfFaces(0)
+template<class T>
+PolygonMeshT<T>::PolygonMeshT(const T nVertices, const std::vector<T>& coordIndex):
+  HalfEdgesT<T>(nVertices,coordIndex),
+  _nParts(0),
+  _cornerPart(),
+  _partCorner(),
+  _vertexPartFirst(),
+  _vertexPart(),
+  _summary(),
+  _vertexCornerFirst(),
+  _vertexCorner(),
+  _vertexNeighborFirst(),
+  _vertexNeighbor(),
+  _boundaryLoopCornerFirst(),
+  _boundaryLoopCorner(),
+  _boundaryLoopVertexFirst(),
+  _boundaryLoopVertex(),
+  _boundaryLoopClosed()
 {
 
-  const int nC = getNumberOfCorners();
-  for (int iC = 0; iC < nC; ++iC) {
-    if(_coordIndex[iC]>=0)
-      continue;
-    ++_numberOfFaces;
-  }
-
-  int nV = getNumberOfVertices();
-  int nE = getNumberOfEdges(); // Edges method
-  // int nF = getNumberOfFaces();
+  const T nC = getNumberOfCorners();
 
+  T nV = getNumberOfVertices();
+  T nE = getNumberOfEdges(); // Edges method
+  // T nF = getNumberOfFaces();
 
-  // 1) classify the vertices as boundary or internal
-  _isBoundaryVertex.resize(nV, false);
-  for (int iC = 0; iC < nC; ++iC) {
-    // - for edge boundary iE label its two end vertices as boundary
-    if (coordIndex[iC] < 0)
-      continue;
-
-    const int iV0 = getSrc(iC);
-    const int iV1 = getDst(iC);
-    const int iE = getEdge(iV0, iV1);
-    if (getNumberOfEdgeHalfEdges(iE) == 1) {
-      _isBoundaryVertex[iV0] = true;
-      _isBoundaryVertex[iV1] = true;
-    }
-  }
 
-  // 2) create a partition of the corners in the stack
-  Partition partition(nC);
-  // 3) for each regular edge
+  // 1) create a partition of the corners in the stack; the join
+  //    operations of the next step run concurrently, and the lock-free
+  //    partition makes the result independent of their order
+  ConcurrentPartitionT<T> partition(nC);
+  // 2) for each regular edge
   //    - get the two half edges incident to the edge
   //    - join the two pairs of corresponding corners across the edge
   //    - you need to take into account the relative orientation of the two incident half-edges
 
-  for (int iE = 0; iE < nE; ++iE) {
-    if (getNumberOfEdgeHalfEdges(iE) == 2) {
-      const int iC00 = getEdgeHalfEdge(iE, 0);
-      const int iC01 = getNext(iC00);
-      const int iC10 = getEdgeHalfEdge(iE, 1);
-      const int iC11 = getNext(iC10);
-
-      // TODO: i am not checking orientation
-      partition.join(iC00, iC11);
-      partition.join(iC01, iC10);
+  Parallel::forChunks(nE,[&](int /*iChunk*/, T begin, T end) {
+    for (T iE = begin; iE < end; ++iE) {
+      if (getNumberOfEdgeHalfEdges(iE) == 2) {
+        const T iC00 = getEdgeHalfEdge(iE, 0);
+        const T iC01 = getNext(iC00);
+        const T iC10 = getEdgeHalfEdge(iE, 1);
+        const T iC11 = getNext(iC10);
+
+        if (getSrc(iC00) == getSrc(iC10)) {
+          // opposite orientation
+          partition.join(iC00, iC10);
+          partition.join(iC01, iC11);
+        } else {
+          // consistently oriented
+          partition.join(iC00, iC11);
+          partition.join(iC01, iC10);
+        }
 
+      }
     }
-  }
+  });
 
   // consistently oriented
   /* \                  / */
@@ -116,68 +155,76 @@ PolygonMesh::PolygonMesh(const int nVertices, const std::vector<int>& coordIndex
   /*  / iC10 --> iC11  \  */
   /* /                  \ */
 
-  // a decision has to be made about inconsistently oriented faces
-  // incident to the same edge, as well as how to deal with singular
-  // edges; for the moment let's assume that the mesh does not have
-  // singular edges, and that pairs of corners corresponding to the
-  // same vertex across inconsistently oriented faces will be joined
+  // the two cases are told apart by comparing the source vertices of
+  // the two half edges, so that only corners pointing to the same
+  // vertex are ever joined; singular edges join nothing
 
   // note that the partition will end up with the corner separators as
   // singletons, but it doesn't matter for the last step, and
   // the partition will be deleted upon return
   
-  // 4) count number of parts per vertex
-  //    - initialize _nPartsVertex array to 0's
-  _nPartsVertex.resize(nV, 0);
-
-  //    - for each corner iC which is a representative of its subset, 
-  //    - get the corresponding vertex index iV and increment _nPartsVertex[iV]
-  //    - note that all the corners in each subset share a common
-  //      vertex index, but multiple subsets may correspond to the
-  //      same vertex index, indicating that the vertex is singular
-
-  std::set<std::pair<int,int>> vertexMap;
-  for (int iC = 0; iC < nC; ++iC) {
-    if (coordIndex[iC] < 0)
+  // 3) count number of parts per vertex
+  //    - the root of each part is its smallest corner, so visiting the
+  //      corners in increasing order meets every root before any other
+  //      corner of its part; each root opens a new part, and every
+  //      other corner copies the part id already assigned to its root
+  //    - all the corners in each part share a common vertex index, so
+  //      each part is counted exactly once, on the vertex of its root;
+  //      no (vertex,part) set or per-vertex stamp array is needed
+  _cornerPart.assign(nC, IndexTraits<T>::none);
+  _vertexPartFirst.assign(nV + 1, 0);
+  _partCorner.clear();
+  for (T iC = 0; iC < nC; ++iC) {
+    if (coordIndex[iC] == IndexTraits<T>::none)
       continue;
 
-    const int idPart = partition.find(iC);
-    if (partition.getSize(idPart) > 0) {
-      const int iV = getSrc(iC);
-      auto vertPart = std::make_pair(iV, idPart);
-      if (!vertexMap.contains(vertPart)) {
-        vertexMap.insert(vertPart);
-        _nPartsVertex[iV]++;
-      }
+    const T iR = partition.find(iC);
+    if (iR == iC) {
+      _cornerPart[iC] = static_cast<T>(_partCorner.size());
+      _partCorner.push_back(iC);
+      _vertexPartFirst[getSrc(iC) + 1]++;
+    } else {
+      _cornerPart[iC] = _cornerPart[iR];
     }
   }
+  _nParts = static_cast<T>(_partCorner.size());
+
+  // 4) list the parts incident to each vertex, in increasing order
+  for (T iV = 0; iV < nV; ++iV)
+    _vertexPartFirst[iV + 1] += _vertexPartFirst[iV];
+  _vertexPart.resize(_nParts);
+  std::vector<T> next(_vertexPartFirst.begin(), _vertexPartFirst.end() - 1);
+  for (T iP = 0; iP < _nParts; ++iP)
+    _vertexPart[next[getSrc(_partCorner[iP])]++] = iP;
+
+  // 5) classify the edges and vertices once, so that the queries
+  //    below run in constant time
+  _summary.build(*this);
 }
 
-int PolygonMesh::getNumberOfFaces() const {
-  return _numberOfFaces;
-}
-
-int PolygonMesh::getNumberOfEdgeFaces(const int iE) const {
+template<class T>
+T PolygonMeshT<T>::getNumberOfEdgeFaces(const T iE) const {
   return getNumberOfEdgeHalfEdges(iE);
 }
 
-int PolygonMesh::getEdgeFace(const int iE, const int j) const {
-  if (iE < 0 || iE >= getNumberOfEdges())
-    return -1;
+template<class T>
+T PolygonMeshT<T>::getEdgeFace(const T iE, const T j) const {
+  if (!IndexTraits<T>::inRange(iE, getNumberOfEdges()))
+    return IndexTraits<T>::none;
 
-  if (j < 0 || j >= getNumberOfEdgeHalfEdges(iE))
-    return -1;
+  if (!IndexTraits<T>::inRange(j, getNumberOfEdgeHalfEdges(iE)))
+    return IndexTraits<T>::none;
 
-  const int iC = getEdgeHalfEdge(iE, j);
+  const T iC = getEdgeHalfEdge(iE, j);
   return getFace(iC);
 }
 
-bool PolygonMesh::isEdgeFace(const int iE, const int iF) const {
-  if (iE < 0 || iE >= getNumberOfEdges())
+template<class T>
+bool PolygonMeshT<T>::isEdgeFace(const T iE, const T iF) const {
+  if (!IndexTraits<T>::inRange(iE, getNumberOfEdges()))
     return false;
 
-  for (int j = 0; j < getNumberOfEdgeHalfEdges(iE); ++j) {
-    const int iC = getEdgeHalfEdge(iE, j);
+  for (const T iC : getEdgeHalfEdges(iE)) {
     if (getFace(iC) == iF)
       return true;
   }
@@ -186,52 +233,338 @@ bool PolygonMesh::isEdgeFace(const int iE, const int iF) const {
 
 // classification of edges
 
-bool PolygonMesh::isBoundaryEdge(const int iE) const {
-
-  return getNumberOfEdgeFaces(iE) == 1;
+template<class T>
+bool PolygonMeshT<T>::isBoundaryEdge(const T iE) const {
+  return _summary.getEdgeClass(iE) & MeshTopologySummaryT<T>::BOUNDARY;
 }
 
-bool PolygonMesh::isRegularEdge(const int iE) const {
-  return getNumberOfEdgeFaces(iE) == 2;
+template<class T>
+bool PolygonMeshT<T>::isRegularEdge(const T iE) const {
+  return _summary.getEdgeClass(iE) & MeshTopologySummaryT<T>::REGULAR;
 }
 
-bool PolygonMesh::isSingularEdge(const int iE) const {
-  return getNumberOfEdgeFaces(iE) > 1;
+template<class T>
+bool PolygonMeshT<T>::isSingularEdge(const T iE) const {
+  return _summary.getEdgeClass(iE) & MeshTopologySummaryT<T>::SINGULAR;
 }
 
 // classification of vertices
 
-bool PolygonMesh::isBoundaryVertex(const int iV) const {
-  const int nV = getNumberOfVertices();
-  return (0<=iV && iV<nV)?_isBoundaryVertex[iV]:false;
+template<class T>
+bool PolygonMeshT<T>::isBoundaryVertex(const T iV) const {
+  return _summary.getVertexClass(iV) & MeshTopologySummaryT<T>::BOUNDARY;
 }
 
-bool PolygonMesh::isSingularVertex(const int iV) const {
-  const int nV = getNumberOfVertices();
-  return (0<=iV && iV<nV && _nPartsVertex[iV]>1);
+template<class T>
+bool PolygonMeshT<T>::isInternalVertex(const T iV) const {
+  return IndexTraits<T>::inRange(iV, getNumberOfVertices()) && !isBoundaryVertex(iV);
+}
+
+template<class T>
+bool PolygonMeshT<T>::isSingularVertex(const T iV) const {
+  return _summary.getVertexClass(iV) & MeshTopologySummaryT<T>::SINGULAR;
 }
 
 // properties of the whole mesh
 
-bool PolygonMesh::isRegular() const {
+template<class T>
+bool PolygonMeshT<T>::isRegular() const {
+  return _summary.isRegular();
+}
+
+template<class T>
+bool PolygonMeshT<T>::hasBoundary() const {
+  return _summary.hasBoundary();
+}
+
+template<class T>
+const MeshTopologySummaryT<T>& PolygonMeshT<T>::getTopologySummary() const {
+  return _summary;
+}
+
+// corner parts
+
+template<class T>
+T PolygonMeshT<T>::getNumberOfParts() const {
+  return _nParts;
+}
+
+template<class T>
+T PolygonMeshT<T>::getCornerPart(const T iC) const {
+  return IndexTraits<T>::inRange(iC, getNumberOfCorners())?_cornerPart[iC]:IndexTraits<T>::none;
+}
+
+template<class T>
+T PolygonMeshT<T>::getPartCorner(const T iP) const {
+  return IndexTraits<T>::inRange(iP, _nParts)?_partCorner[iP]:IndexTraits<T>::none;
+}
+
+template<class T>
+T PolygonMeshT<T>::getPartVertex(const T iP) const {
+  return IndexTraits<T>::inRange(iP, _nParts)?getSrc(_partCorner[iP]):IndexTraits<T>::none;
+}
+
+template<class T>
+T PolygonMeshT<T>::getNumberOfVertexParts(const T iV) const {
+  if (!IndexTraits<T>::inRange(iV, getNumberOfVertices()))
+    return 0;
+  return _vertexPartFirst[iV + 1] - _vertexPartFirst[iV];
+}
+
+template<class T>
+T PolygonMeshT<T>::getVertexPart(const T iV, const T j) const {
+  if (!IndexTraits<T>::inRange(j, getNumberOfVertexParts(iV)))
+    return IndexTraits<T>::none;
+  return _vertexPart[_vertexPartFirst[iV] + j];
+}
 
-  for (int iE = 0; iE < getNumberOfEdges(); ++iE) {
-    if (isSingularEdge(iE))
-      return false;
+template<class T>
+std::span<const T> PolygonMeshT<T>::getVertexParts(const T iV) const {
+  const T n = getNumberOfVertexParts(iV);
+  if (n == 0)
+    return {};
+  return {_vertexPart.data() + _vertexPartFirst[iV], static_cast<size_t>(n)};
+}
+
+// vertex stars
+
+template<class T>
+void PolygonMeshT<T>::buildVertexStars() {
+  const T nV = getNumberOfVertices();
+  const T nE = getNumberOfEdges();
+  const T nC = getNumberOfCorners();
+
+  // 1) bucket the corners by source vertex, and the two ends of every
+  //    edge by the other end
+  countingSort(nV, nC,
+               [&](int64_t iC) { return getSrc(static_cast<T>(iC)); },
+               [&](int64_t iC) { return static_cast<T>(iC); },
+               _vertexCornerFirst, _vertexCorner);
+  countingSort(nV, 2 * static_cast<int64_t>(nE),
+               [&](int64_t i) {
+                 const T iE = static_cast<T>(i / 2);
+                 return (i & 1) ? getVertex1(iE) : getVertex0(iE); },
+               [&](int64_t i) {
+                 const T iE = static_cast<T>(i / 2);
+                 return (i & 1) ? getVertex0(iE) : getVertex1(iE); },
+               _vertexNeighborFirst, _vertexNeighbor);
+
+  // 2) sort the lists, and order the ones of the regular vertices by
+  //    walking around the vertex across the regular edges; the walk
+  //    starts at a boundary or singular edge if there is one, and
+  //    crosses the edge of the corner not crossed to reach it; if the
+  //    walk does not visit every corner and every neighbor exactly
+  //    once the sorted lists are kept
+  Parallel::forChunks(nV,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    std::vector<T> corner, neighbor, sorted;
+    for (T iV = static_cast<T>(begin); iV < static_cast<T>(end); ++iV) {
+      auto c0 = _vertexCorner.begin() + _vertexCornerFirst[iV];
+      auto c1 = _vertexCorner.begin() + _vertexCornerFirst[iV + 1];
+      auto n0 = _vertexNeighbor.begin() + _vertexNeighborFirst[iV];
+      auto n1 = _vertexNeighbor.begin() + _vertexNeighborFirst[iV + 1];
+      std::sort(c0, c1);
+      std::sort(n0, n1);
+      if (c0 == c1 || getNumberOfVertexParts(iV) != 1)
+        continue;
+
+      // other end of the edge of half edge iH, which is incident to iV
+      auto other = [&](const T iH) {
+        const T iS = getSrc(iH);
+        return (iS == iV) ? getDst(iH) : iS;
+      };
+
+      // iIn is the half edge of corner iC crossed to reach it
+      T iC = *c0, iIn = iC;
+      bool isOpen = false;
+      for (auto c = c0; c != c1 && !isOpen; ++c) {
+        if (getTwin(*c) == IndexTraits<T>::none) {
+          iC = iIn = *c; isOpen = true;
+        } else if (getTwin(getPrev(*c)) == IndexTraits<T>::none) {
+          iC = *c; iIn = getPrev(*c); isOpen = true;
+        }
+      }
+
+      corner.clear();
+      neighbor.clear();
+      if (isOpen)
+        neighbor.push_back(other(iIn));
+      const size_t nCV = static_cast<size_t>(c1 - c0);
+      while (corner.size() < nCV) {
+        const T iOut = (iIn == iC) ? getPrev(iC) : iC;
+        corner.push_back(iC);
+        neighbor.push_back(other(iOut));
+        const T iT = getTwin(iOut);
+        if (iT == IndexTraits<T>::none)
+          break;
+        iC  = (getSrc(iT) == iV) ? iT : getNext(iT);
+        iIn = iT;
+        if (iC == corner[0])
+          break;
+      }
+
+      if (corner.size() != nCV || neighbor.size() != static_cast<size_t>(n1 - n0))
+        continue;
+      // around internal vertices the last neighbor, shared by the last
+      // and the first corner, goes first
+      if (!isOpen)
+        std::rotate(neighbor.begin(), neighbor.end() - 1, neighbor.end());
+      sorted.assign(neighbor.begin(), neighbor.end());
+      std::sort(sorted.begin(), sorted.end());
+      if (!std::equal(sorted.begin(), sorted.end(), n0))
+        continue;
+      std::copy(corner.begin(), corner.end(), c0);
+      std::copy(neighbor.begin(), neighbor.end(), n0);
+    }
+  });
+}
+
+template<class T>
+bool PolygonMeshT<T>::hasVertexStars() const {
+  return !_vertexCornerFirst.empty();
+}
+
+template<class T>
+std::span<const T> PolygonMeshT<T>::getVertexCorners(const T iV) const {
+  if (!hasVertexStars() || !IndexTraits<T>::inRange(iV, getNumberOfVertices()))
+    return {};
+  return {_vertexCorner.data() + _vertexCornerFirst[iV],
+          static_cast<size_t>(_vertexCornerFirst[iV + 1] - _vertexCornerFirst[iV])};
+}
+
+template<class T>
+std::span<const T> PolygonMeshT<T>::getVertexNeighbors(const T iV) const {
+  if (!hasVertexStars() || !IndexTraits<T>::inRange(iV, getNumberOfVertices()))
+    return {};
+  return {_vertexNeighbor.data() + _vertexNeighborFirst[iV],
+          static_cast<size_t>(_vertexNeighborFirst[iV + 1] - _vertexNeighborFirst[iV])};
+}
+
+template<class T>
+T PolygonMeshT<T>::getValence(const T iV) const {
+  return static_cast<T>(getVertexNeighbors(iV).size());
+}
+
+// boundary loops
+
+template<class T>
+void PolygonMeshT<T>::buildBoundaryLoops() {
+  const T nE = getNumberOfEdges();
+  const T nC = getNumberOfCorners();
+  constexpr T none = IndexTraits<T>::none;
+
+  // 1) list the boundary half edges, and index them by corner
+  std::vector<T> boundary;
+  std::vector<T> boundaryIndex(nC, none);
+  for (T iE = 0; iE < nE; ++iE) {
+    if (getNumberOfEdgeHalfEdges(iE) == 1) {
+      const T iC = getEdgeHalfEdge(iE, 0);
+      boundaryIndex[iC] = static_cast<T>(boundary.size());
+      boundary.push_back(iC);
+    }
+  }
+  const T nB = static_cast<T>(boundary.size());
+
+  // 2) link[2*iB+e] is the end of the boundary half edge reached by
+  //    walking around the end e of boundary[iB], where e=0 is the src
+  //    and e=1 the dst, coded in the same way; the walk enters each
+  //    corner through one of its two edges incident to the vertex,
+  //    leaves it through the other one, and stops at the first
+  //    boundary edge, or at a singular edge, where the link is -1
+  std::vector<T> link(2 * static_cast<size_t>(nB), none);
+  for (T iB = 0; iB < nB; ++iB) {
+    for (T e = 0; e < 2; ++e) {
+      const T iH = boundary[iB];
+      const T iV = (e == 0) ? getSrc(iH) : getDst(iH);
+      T iIn = iH;
+      T iC = (getSrc(iH) == iV) ? iH : getNext(iH);
+      for (;;) {
+        const T iOut = (iIn == iC) ? getPrev(iC) : iC;
+        const T jB = boundaryIndex[iOut];
+        if (jB != none) {
+          link[2 * iB + e] = 2 * jB + ((getSrc(iOut) == iV) ? 0 : 1);
+          break;
+        }
+        const T iT = getTwin(iOut);
+        if (iT == none)
+          break;
+        iC = (getSrc(iT) == iV) ? iT : getNext(iT);
+        iIn = iT;
+      }
+    }
   }
 
-  for (int iV = 0; iV < getNumberOfVertices(); ++iV) {
-    if (isSingularVertex(iV))
-      return false;
+  // 3) chain the boundary half edges; a loop enters each half edge
+  //    through one end, and leaves it through the other one
+  _boundaryLoopCornerFirst.assign(1, 0);
+  _boundaryLoopCorner.clear();
+  _boundaryLoopCorner.reserve(nB);
+  _boundaryLoopVertexFirst.assign(1, 0);
+  _boundaryLoopVertex.clear();
+  _boundaryLoopClosed.clear();
+  std::vector<uint8_t> visited(nB, 0);
+  auto chain = [&](T iB, T e, const bool isClosed) {
+    for (;;) {
+      visited[iB] = 1;
+      const T iH = boundary[iB];
+      _boundaryLoopCorner.push_back(iH);
+      _boundaryLoopVertex.push_back((e == 0) ? getSrc(iH) : getDst(iH));
+      const T next = link[2 * iB + 1 - e];
+      if (next == none) {
+        _boundaryLoopVertex.push_back((e == 0) ? getDst(iH) : getSrc(iH));
+        break;
+      }
+      iB = next / 2;
+      e = next % 2;
+      if (visited[iB])
+        break;
+    }
+    _boundaryLoopCornerFirst.push_back(static_cast<T>(_boundaryLoopCorner.size()));
+    _boundaryLoopVertexFirst.push_back(static_cast<T>(_boundaryLoopVertex.size()));
+    _boundaryLoopClosed.push_back(isClosed ? 1 : 0);
+  };
+  for (T iB = 0; iB < nB; ++iB) {
+    for (T e = 0; e < 2; ++e) {
+      if (!visited[iB] && link[2 * iB + e] == none)
+        chain(iB, e, false);
+    }
+  }
+  for (T iB = 0; iB < nB; ++iB) {
+    if (!visited[iB])
+      chain(iB, 0, true);
   }
+}
 
-  return true;
+template<class T>
+bool PolygonMeshT<T>::hasBoundaryLoops() const {
+  return !_boundaryLoopCornerFirst.empty();
 }
 
-bool PolygonMesh::hasBoundary() const {
-  for (int iE = 0; iE < getNumberOfEdges(); ++iE) {
-    if (isBoundaryEdge(iE))
-      return true;
-  }
-  return false;
+template<class T>
+T PolygonMeshT<T>::getNumberOfBoundaryLoops() const {
+  return static_cast<T>(_boundaryLoopClosed.size());
 }
+
+template<class T>
+bool PolygonMeshT<T>::isBoundaryLoopClosed(const T iL) const {
+  return IndexTraits<T>::inRange(iL, getNumberOfBoundaryLoops()) && _boundaryLoopClosed[iL] != 0;
+}
+
+template<class T>
+std::span<const T> PolygonMeshT<T>::getBoundaryLoopCorners(const T iL) const {
+  if (!IndexTraits<T>::inRange(iL, getNumberOfBoundaryLoops()))
+    return {};
+  return {_boundaryLoopCorner.data() + _boundaryLoopCornerFirst[iL],
+          static_cast<size_t>(_boundaryLoopCornerFirst[iL + 1] - _boundaryLoopCornerFirst[iL])};
+}
+
+template<class T>
+std::span<const T> PolygonMeshT<T>::getBoundaryLoopVertices(const T iL) const {
+  if (!IndexTraits<T>::inRange(iL, getNumberOfBoundaryLoops()))
+    return {};
+  return {_boundaryLoopVertex.data() + _boundaryLoopVertexFirst[iL],
+          static_cast<size_t>(_boundaryLoopVertexFirst[iL + 1] - _boundaryLoopVertexFirst[iL])};
+}
+
+template class PolygonMeshT<int>;
+template class PolygonMeshT<uint32_t>;
+template class PolygonMeshT<int64_t>;
@@ -41,13 +41,34 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 #include "HalfEdges.hpp"
+#include "MeshTopologySummary.hpp"
 
-class PolygonMesh : public HalfEdges {
+template<class T>
+class PolygonMeshT : public HalfEdgesT<T> {
 
 public:
 
+  // T is the index type (see IndexTraits.hpp); the values returned as
+  // -1 below are IndexTraits<T>::none
+
+  using HalfEdgesT<T>::getNumberOfVertices;
+  using HalfEdgesT<T>::getNumberOfEdges;
+  using HalfEdgesT<T>::getNumberOfCorners;
+  using HalfEdgesT<T>::getFace;
+  using HalfEdgesT<T>::getSrc;
+  using HalfEdgesT<T>::getDst;
+  using HalfEdgesT<T>::getNext;
+  using HalfEdgesT<T>::getPrev;
+  using HalfEdgesT<T>::getTwin;
+  using HalfEdgesT<T>::getVertex0;
+  using HalfEdgesT<T>::getVertex1;
+  using HalfEdgesT<T>::getNumberOfEdgeHalfEdges;
+  using HalfEdgesT<T>::getEdgeHalfEdge;
+  using HalfEdgesT<T>::getEdgeHalfEdges;
+
   // inherits from Edges
   //
   // void    reset(const int nV);
@@ -68,20 +89,19 @@ public:
   // int     getTwin(const int iC) const;
   // int     getNumberOfEdgeHalfEdges(const int iE);
   // int     getEdgeHalfEdge(const int iE, const int j);
+  // span    getEdgeHalfEdges(const int iE) const;
+  // int     getNumberOfFaces() const;
+  // int     getFaceSize(const int iF) const;
+  // int     getFaceFirstCorner(const int iF) const;
+  // span    getFaceVertices(const int iF) const;
 
-   PolygonMesh(int nV, const std::vector<int>& coordIndex);
-
-  /**
-   * number of -1's in the coordIndex argument
-   *
-   */
-   int getNumberOfFaces() const;
+   PolygonMeshT(T nV, const std::vector<T>& coordIndex);
 
   /**
    * number of faces incident to each edge; note that this is equal to the number of half edges incident to each edge
    *
    */
-   int getNumberOfEdgeFaces(int iE) const;
+   T getNumberOfEdgeFaces(T iE) const;
 
   /**
    * if the arguments fall within their respective ranges, this method returns the j-th face
@@ -89,34 +109,34 @@ public:
    * and it returns -1 if either argument is out of range
    *
    */
-   int getEdgeFace(int iE, int j) const;
+   T getEdgeFace(T iE, T j) const;
 
   /**
    * if the arguments fall within their respective ranges, this method returns true if iF is found
    * in the list of faces incident to the edge iE; otherwise it returns false
    *
    */
-   bool isEdgeFace(int iE, int iF) const;
+   bool isEdgeFace(T iE, T iF) const;
 
   // edges are classified as boundary, regular, or singular depending
   // on the number of incident faces: 1=boundary, 2=regular, 3 or
   // more=singular
-   bool isBoundaryEdge(int iE) const;
-   bool isRegularEdge(int iE) const;
-   bool isSingularEdge(int iE) const;
+   bool isBoundaryEdge(T iE) const;
+   bool isRegularEdge(T iE) const;
+   bool isSingularEdge(T iE) const;
 
     // a vertex is boundary if and only if it is the end of a boundary edge
-    bool isBoundaryVertex(int iV) const;
+    bool isBoundaryVertex(T iV) const;
 
     // a vertex is internal if and only if it is not a boundary edge
-    bool isInternalVertex(int iV) const;
+    bool isInternalVertex(T iV) const;
 
   /**
    * a vertex is singular if the number of connected components in the subgraph of the dual
    * graph defined by the subset of faces incident to the vertex is larger than 1; otherwise it is regular
    *
    */
-    bool isSingularVertex(int iV) const;
+    bool isSingularVertex(T iV) const;
 
   // a way to determine which vertices are singular and which are
   // regular is to construct a partition of the corners of the mesh,
@@ -155,6 +175,27 @@ public:
   // vertex, then the vertex is regular. If two or more of these parts
   // point to a given vertex, then the vertex is singular. 
 
+  // The parts are numbered in the order of their smallest corner, and
+  // they are kept after construction so that singular vertices can
+  // later be split into one vertex per part.
+
+  // number of corner parts, not counting the face separators
+  T getNumberOfParts() const;
+
+  // part containing corner iC; -1 for separators or out of range
+  T getCornerPart(T iC) const;
+
+  // smallest corner of part iP, and the vertex shared by its corners;
+  // -1 if iP is out of range
+  T getPartCorner(T iP) const;
+  T getPartVertex(T iP) const;
+
+  // parts incident to vertex iV, in increasing order; a vertex is
+  // singular if and only if it has more than one part
+  T getNumberOfVertexParts(T iV) const;
+  T getVertexPart(T iV, T j) const;
+  std::span<const T> getVertexParts(T iV) const;
+
    // the polygon mesh is regular if and only if it does not have any
    // singular edges and it does not have any singular vertices
    bool isRegular() const;
@@ -163,12 +204,108 @@ public:
    // boundary edge
    bool hasBoundary() const;
 
+   // classification of all the edges and vertices, computed once
+   // during construction, with the counts per class and the Euler
+   // characteristic of the mesh
+   const MeshTopologySummaryT<T>& getTopologySummary() const;
+
+  // vertex stars
+
+  // - builds the optional vertex to corner and vertex to vertex
+  //   indices, stored as CSR arrays; the constructor does not build
+  //   them, and until this method is called the methods below return
+  //   empty spans and 0
+  // - both indices are filled with a parallel counting sort, and then
+  //   the lists of the regular vertices are ordered around the vertex
+  //   in parallel; the lists of the singular vertices are sorted in
+  //   increasing order; the result does not depend on the number of
+  //   threads
+  void buildVertexStars();
+  bool hasVertexStars() const;
+
+  // - corners iC with getSrc(iC)==iV
+  // - if iV is regular, consecutive corners share an edge, and the
+  //   twin of getPrev(iC) comes next when the faces are consistently
+  //   oriented; if iV is also a boundary vertex the list starts and
+  //   ends at the two boundary edges
+  std::span<const T> getVertexCorners(T iV) const;
+
+  // - vertices joined to iV by an edge of the mesh
+  // - if iV is regular they are listed in the same order as the
+  //   corners, so that the corner getVertexCorners(iV)[j] lies between
+  //   the neighbors j and j+1, modulo the valence for internal
+  //   vertices; for boundary vertices the first and the last neighbor
+  //   are the ends of the two boundary edges
+  std::span<const T> getVertexNeighbors(T iV) const;
+
+  // number of edges incident to iV, which is the size of
+  // getVertexNeighbors(iV)
+  T getValence(T iV) const;
+
+  // boundary loops
+
+  // - builds the optional list of boundary loops, chaining the
+  //   boundary half edges in a single pass; the constructor does not
+  //   build it, and until this method is called the methods below
+  //   return 0, false, and empty spans
+  // - two boundary edges are consecutive in a loop if they share a
+  //   vertex, and they can be joined by a walk around the vertex
+  //   which only crosses regular edges; at singular vertices every
+  //   fan of faces joins its own pair of boundary edges, so each
+  //   loop passes as many times through the vertex as it has fans
+  //   with boundary
+  // - if the walk reaches a singular edge, the chain ends there, and
+  //   it is reported as an open loop; the open loops are listed
+  //   first, and then the closed ones in increasing order of their
+  //   smallest edge index
+  // - closed loops follow the orientation of their first half edge
+  void buildBoundaryLoops();
+  bool hasBoundaryLoops() const;
+
+  T getNumberOfBoundaryLoops() const;
+  bool isBoundaryLoopClosed(T iL) const;
+
+  // - boundary half edges of loop iL, in loop order; each one is the
+  //   only corner of its edge
+  // - the vertex getBoundaryLoopVertices(iL)[j] is the end of
+  //   getBoundaryLoopCorners(iL)[j] where the loop enters it; open
+  //   loops have one more vertex than corners, the last end of the
+  //   chain; the half edges of loops through faces which are not
+  //   consistently oriented may be traversed from dst to src
+  std::span<const T> getBoundaryLoopCorners(T iL) const;
+  std::span<const T> getBoundaryLoopVertices(T iL) const;
+
 private:
 
   // consider these private variables a suggestion
   // feel free to decide how to implement this class
 
-  std::vector<int> _nPartsVertex;
-  std::vector<bool> _isBoundaryVertex;
-  int _numberOfFaces;
+  // corner partition, and CSR lists of the parts incident to each vertex
+  T              _nParts;
+  std::vector<T> _cornerPart;
+  std::vector<T> _partCorner;
+  std::vector<T> _vertexPartFirst;
+  std::vector<T> _vertexPart;
+
+  MeshTopologySummaryT<T> _summary;
+
+  // optional vertex stars; empty until buildVertexStars() is called
+  std::vector<T> _vertexCornerFirst;
+  std::vector<T> _vertexCorner;
+  std::vector<T> _vertexNeighborFirst;
+  std::vector<T> _vertexNeighbor;
+
+  // optional boundary loops; empty until buildBoundaryLoops() is
+  // called
+  std::vector<T>       _boundaryLoopCornerFirst;
+  std::vector<T>       _boundaryLoopCorner;
+  std::vector<T>       _boundaryLoopVertexFirst;
+  std::vector<T>       _boundaryLoopVertex;
+  std::vector<uint8_t> _boundaryLoopClosed;
 };
+
+extern template class PolygonMeshT<int>;
+extern template class PolygonMeshT<uint32_t>;
+extern template class PolygonMeshT<int64_t>;
+
+using PolygonMesh = PolygonMeshT<int>;
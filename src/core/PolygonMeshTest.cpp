@@ -40,6 +40,8 @@
 // DAMAGE.
 
 #include "PolygonMeshTest.hpp"
+#include "MeshComponents.hpp"
+#include "DualGraph.hpp"
 
 #include <cassert>
 #include <iostream>
@@ -49,7 +51,8 @@
 #include <wrl/IndexedFaceSet.hpp>
 #include <wrl/SceneGraphTraversal.hpp>
 
-PolygonMeshTest::PolygonMeshTest(SceneGraph& sceneGraph, const std::string& indent, std::ostream& ostr):_ostr(ostr) {
+PolygonMeshTest::PolygonMeshTest(SceneGraph& sceneGraph, const std::string& indent,
+                                 std::ostream& ostr, const bool debug):_ostr(ostr) {
   _ostr << indent << "PolygonMeshTest {" << endl;
 
   int nIndexedFaceSet = 0;
@@ -98,61 +101,58 @@ PolygonMeshTest::PolygonMeshTest(SceneGraph& sceneGraph, const std::string& inde
 
         PolygonMesh pMesh(nVifs,coordIndex);
 
-        int nV = pMesh.getNumberOfVertices();
-        int nE = pMesh.getNumberOfEdges();
-        int nF = pMesh.getNumberOfFaces();
-        int nC = pMesh.getNumberOfCorners();
-
-        _ostr << indent << "        nV          = " << nV << endl;
-        _ostr << indent << "        nE          = " << nE << endl;
-        _ostr << indent << "        nF          = " << nF << endl;
-        _ostr << indent << "        nC          = " << nC << endl;
-
-        // print info about the polygon mesh
-
-        int nV_boundary  = 0;
-        int nV_internal  = 0;
-        int nV_singular  = 0;
-        int nV_regular   = 0;
-        int nE_boundary  = 0;
-        int nE_regular   = 0;
-        int nE_singular  = 0;
-        int nE_other     = 0;
-
-        int iE,iV;
-
-        for(iE=0;iE<nE;iE++) {
-          if(pMesh.isBoundaryEdge(iE)) {
-            nE_boundary++;
-          } else if(pMesh.isRegularEdge(iE)) {
-            nE_regular++;
-          } else if(pMesh.isSingularEdge(iE)) {
-            nE_singular++;
-          } else {
-            nE_other++;
-          }
+        // print info about the polygon mesh; the classification
+        // counts are computed once by the PolygonMesh constructor
+
+        printSummary(pMesh.getTopologySummary(),indent+"        ",_ostr);
+
+        MeshComponents components;
+        components.build(pMesh);
+
+        _ostr << indent << "        nComponents = " << components.getNumberOfComponents() << endl;
+        _ostr << indent << "        nK_noOrient = " << components.getNumberOfNonOrientableComponents() << endl;
+        _ostr << indent << "        nF_flipped  = " << components.getNumberOfFlippedFaces() << endl;
+
+        DualGraph dual;
+        dual.build(pMesh);
+
+        _ostr << indent << "        nDualLinks  = " << dual.getNumberOfLinks() << endl;
+
+        pMesh.buildBoundaryLoops();
+
+        // - nL_size[a..b] counts the loops with a to b corners, in
+        //   power of two bins, so that meshes with many holes still
+        //   produce a short report
+        int nL = pMesh.getNumberOfBoundaryLoops();
+        int nL_open = 0;
+        size_t nC_min = 0, nC_max = 0;
+        vector<int> nL_size;
+        for(int iL=0;iL<nL;iL++) {
+          if(!pMesh.isBoundaryLoopClosed(iL)) nL_open++;
+          const size_t nC = pMesh.getBoundaryLoopCorners(iL).size();
+          if(iL==0 || nC<nC_min) nC_min = nC;
+          if(iL==0 || nC>nC_max) nC_max = nC;
+          size_t bin = 0;
+          while((size_t(2)<<bin)<=nC) bin++;
+          if(nL_size.size()<=bin) nL_size.resize(bin+1,0);
+          nL_size[bin]++;
         }
 
-        for(iV=0;iV<nV;iV++) {
-          if(pMesh.isBoundaryVertex(iV))
-            nV_boundary++;
-          if(pMesh.isSingularVertex(iV))
-            nV_singular++;
+        _ostr << indent << "        nL_boundary = " << nL << endl;
+        _ostr << indent << "        nL_open     = " << nL_open << endl;
+        if(nL>0) {
+          _ostr << indent << "        nC_loopMin  = " << nC_min << endl;
+          _ostr << indent << "        nC_loopMax  = " << nC_max << endl;
+          for(size_t bin=0;bin<nL_size.size();bin++)
+            if(nL_size[bin]>0)
+              _ostr << indent << "        nL_size[" << (size_t(1)<<bin) << ".."
+                    << (size_t(2)<<bin)-1 << "] = " << nL_size[bin] << endl;
+        }
+        for(int iL=0;debug && iL<nL;iL++) {
+          _ostr << indent << "        boundaryLoop[" << iL << "] nC = "
+                << pMesh.getBoundaryLoopCorners(iL).size()
+                << (pMesh.isBoundaryLoopClosed(iL)?"":" open") << endl;
         }
-
-        nV_internal = nV-nV_boundary;
-        nV_regular  = nV-nV_singular;
-
-        _ostr << indent << "        nV_boundary = " << nV_boundary << endl;
-        _ostr << indent << "        nV_internal = " << nV_internal << endl;
-        _ostr << indent << "        nV_regular  = " << nV_regular  << endl;
-        _ostr << indent << "        nV_singular = " << nV_singular << endl;
-        _ostr << indent << "        nE_boundary = " << nE_boundary << endl;
-        _ostr << indent << "        nE_regular  = " << nE_regular  << endl;
-        _ostr << indent << "        nE_singular = " << nE_singular << endl;
-        _ostr << indent << "        nE_other    = " << nE_other    << endl;
-        _ostr << indent << "        isRegular   = " << pMesh.isRegular() << endl;
-        _ostr << indent << "        hasBoundary = " << pMesh.hasBoundary() << endl;
 
         _ostr << indent << "      } PolygonMesh" << endl;
         _ostr << indent << "    } IndexedFaceSet" << endl;
@@ -49,7 +49,34 @@ class PolygonMeshTest {
   
 public:
 
-  PolygonMeshTest(SceneGraph& sceneGraph, const std::string& indent="", std::ostream& ostr=cout);
+  // prints the topology report of every IndexedFaceSet in the scene
+  // graph; the boundary loops are summarized by their number and a
+  // histogram of their sizes, and listed one per line only if debug
+  // is true
+  PolygonMeshTest(SceneGraph& sceneGraph, const std::string& indent="",
+                  std::ostream& ostr=cout, const bool debug=false);
+
+  // print the global counts of a MeshTopologySummary, or of a
+  // StreamingTopologySummary, one per line, so that the reports of
+  // the in-core and out-of-core checks can be compared line by line
+  template<class Summary>
+  static void printSummary(const Summary& summary, const std::string& indent, std::ostream& ostr) {
+    ostr << indent << "nV          = " << summary.getNumberOfVertices()         << endl;
+    ostr << indent << "nE          = " << summary.getNumberOfEdges()            << endl;
+    ostr << indent << "nF          = " << summary.getNumberOfFaces()            << endl;
+    ostr << indent << "nC          = " << summary.getNumberOfCorners()          << endl;
+    ostr << indent << "nV_boundary = " << summary.getNumberOfBoundaryVertices() << endl;
+    ostr << indent << "nV_internal = " << summary.getNumberOfInternalVertices() << endl;
+    ostr << indent << "nV_regular  = " << summary.getNumberOfRegularVertices()  << endl;
+    ostr << indent << "nV_singular = " << summary.getNumberOfSingularVertices() << endl;
+    ostr << indent << "nE_boundary = " << summary.getNumberOfBoundaryEdges()    << endl;
+    ostr << indent << "nE_regular  = " << summary.getNumberOfRegularEdges()     << endl;
+    ostr << indent << "nE_singular = " << summary.getNumberOfSingularEdges()    << endl;
+    ostr << indent << "nE_other    = " << summary.getNumberOfOtherEdges()       << endl;
+    ostr << indent << "eulerChar   = " << summary.getEulerCharacteristic()      << endl;
+    ostr << indent << "isRegular   = " << summary.isRegular()                   << endl;
+    ostr << indent << "hasBoundary = " << summary.hasBoundary()                 << endl;
+  }
 
 private:
 
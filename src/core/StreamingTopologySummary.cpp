@@ -0,0 +1,358 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// StreamingTopologySummary.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "StreamingTopologySummary.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+  bool seekFile(FILE* fp, const int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(fp,offset,SEEK_SET)==0;
+#else
+    return fseeko(fp,static_cast<off_t>(offset),SEEK_SET)==0;
+#endif
+  }
+
+  // one record per non-degenerate half edge; (v0,v1) is the edge,
+  // with v0<v1, and c0 and c1 are the corners of the face at v0 and v1
+  struct EdgeRecord {
+    int64_t v0,v1,c0,c1;
+    bool operator<(const EdgeRecord& r) const {
+      return std::tie(v0,v1,c0,c1)<std::tie(r.v0,r.v1,r.c0,r.c1);
+    }
+  };
+
+  // records of the vertex v
+  // - a==b>=0 : the corner a points to v
+  // - a!=b    : the corners a and b of v are joined across a regular edge
+  // - a==b<0  : v is the end of a boundary edge
+  struct VertexRecord {
+    int64_t v,a,b;
+    bool operator<(const VertexRecord& r) const {
+      return std::tie(v,a,b)<std::tie(r.v,r.a,r.b);
+    }
+  };
+
+  // external merge sort of trivially copyable records
+  // - the records are accumulated in a buffer of at most maxRecords
+  //   records; every time the buffer is full, it is sorted and
+  //   appended to a temporary file as a sorted run
+  // - merge() visits all the records in increasing order; if no run
+  //   was spilled the buffer is sorted in memory, otherwise the runs
+  //   are merged with a priority queue, reading each run in blocks
+  //   which together fit in the same maxRecords budget
+  template<class R>
+  class ExternalSort {
+
+  public:
+
+    explicit ExternalSort(const size_t maxRecords):
+      _maxRecords(std::max<size_t>(maxRecords,1024)),
+      _nWritten(0),
+      _file(nullptr) {
+    }
+
+    ~ExternalSort() {
+      if(_file) fclose(_file);
+    }
+
+    int getNumberOfRuns() const {
+      return static_cast<int>(_runFirst.size());
+    }
+
+    void push(const R& r) {
+      if(_buffer.size()==_maxRecords)
+        _spill();
+      if(_buffer.capacity()==0)
+        _buffer.reserve(_maxRecords);
+      _buffer.push_back(r);
+    }
+
+    void merge(const std::function<void(const R&)>& visit) {
+      if(_runFirst.empty()) {
+        std::sort(_buffer.begin(),_buffer.end());
+        for(const R& r : _buffer)
+          visit(r);
+      } else {
+        if(!_buffer.empty())
+          _spill();
+        std::vector<R>().swap(_buffer);
+        _mergeRuns(visit);
+      }
+      std::vector<R>().swap(_buffer);
+      _runFirst.clear();
+      _runSize.clear();
+      _nWritten = 0;
+      if(_file) { fclose(_file); _file = nullptr; }
+    }
+
+  private:
+
+    void _spill() {
+      std::sort(_buffer.begin(),_buffer.end());
+      if(_file==nullptr && (_file = std::tmpfile())==nullptr)
+        throw std::runtime_error("unable to create temporary file");
+      if(!seekFile(_file,_nWritten*static_cast<int64_t>(sizeof(R))) ||
+         fwrite(_buffer.data(),sizeof(R),_buffer.size(),_file)!=_buffer.size())
+        throw std::runtime_error("unable to write temporary file");
+      _runFirst.push_back(_nWritten);
+      _runSize.push_back(static_cast<int64_t>(_buffer.size()));
+      _nWritten += static_cast<int64_t>(_buffer.size());
+      _buffer.clear();
+    }
+
+    void _mergeRuns(const std::function<void(const R&)>& visit) {
+      const int nRuns = getNumberOfRuns();
+      const size_t nBlock = std::max<size_t>(_maxRecords/static_cast<size_t>(nRuns),1);
+
+      std::vector<std::vector<R>> block(static_cast<size_t>(nRuns));
+      std::vector<size_t>         blockPos(static_cast<size_t>(nRuns),0);
+      std::vector<int64_t>        next(_runFirst);
+      std::vector<int64_t>        left(_runSize);
+
+      // refill the block of run i; returns false if the run is exhausted
+      auto refill = [&](const int i)->bool {
+        const size_t n = static_cast<size_t>(std::min<int64_t>(left[i],static_cast<int64_t>(nBlock)));
+        if(n==0) return false;
+        block[i].resize(n);
+        if(!seekFile(_file,next[i]*static_cast<int64_t>(sizeof(R))) ||
+           fread(block[i].data(),sizeof(R),n,_file)!=n)
+          throw std::runtime_error("unable to read temporary file");
+        next[i] += static_cast<int64_t>(n);
+        left[i] -= static_cast<int64_t>(n);
+        blockPos[i] = 0;
+        return true;
+      };
+
+      using Head = std::pair<R,int>;
+      auto greater = [](const Head& h0, const Head& h1) {
+        return h1.first<h0.first;
+      };
+      std::priority_queue<Head,std::vector<Head>,decltype(greater)> heap(greater);
+      for(int i=0;i<nRuns;i++)
+        if(refill(i))
+          heap.push({block[i][0],i});
+
+      while(!heap.empty()) {
+        const Head h = heap.top();
+        heap.pop();
+        visit(h.first);
+        const int i = h.second;
+        if(++blockPos[i]<block[i].size() || refill(i))
+          heap.push({block[i][blockPos[i]],i});
+      }
+    }
+
+    size_t               _maxRecords;
+    std::vector<R>       _buffer;
+    int64_t              _nWritten;
+    FILE*                _file;
+    std::vector<int64_t> _runFirst;
+    std::vector<int64_t> _runSize;
+  };
+
+} // namespace
+
+struct StreamingTopologySummary::Sorters {
+  ExternalSort<EdgeRecord>   edges;
+  ExternalSort<VertexRecord> vertices;
+  // each sorter gets one half of the budget
+  explicit Sorters(const size_t memoryBudget):
+    edges(memoryBudget/2/sizeof(EdgeRecord)),
+    vertices(memoryBudget/2/sizeof(VertexRecord)) {
+  }
+};
+
+StreamingTopologySummary::StreamingTopologySummary(const size_t memoryBudget):
+  _memoryBudget(memoryBudget),
+  _nRuns(0),
+  _maxVertex(-1),
+  _nV(0),
+  _nE(0),
+  _nF(0),
+  _nC(0),
+  _nVBoundary(0),
+  _nVSingular(0),
+  _nEBoundary(0),
+  _nERegular(0),
+  _nESingular(0),
+  _sorters() {
+}
+
+StreamingTopologySummary::~StreamingTopologySummary() = default;
+
+void StreamingTopologySummary::begin() {
+  _nRuns = 0;
+  _maxVertex = -1;
+  _nV = _nE = _nF = _nC = 0;
+  _nEBoundary = _nERegular = _nESingular = 0;
+  _nVBoundary = _nVSingular = 0;
+  _sorters = std::make_unique<Sorters>(_memoryBudget);
+}
+
+void StreamingTopologySummary::addFace(const std::span<const int64_t> face) {
+  if(!_sorters)
+    throw std::runtime_error("StreamingTopologySummary::addFace() called before begin()");
+
+  // the corners of the face are numbered as in a coordIndex array,
+  // where every face is followed by a -1 separator
+  const int64_t iC0 = _nC;
+  const size_t  n   = face.size();
+  for(size_t j=0;j<n;j++) {
+    const int64_t iV0 = face[j];
+    if(iV0<0)
+      throw std::runtime_error("negative vertex index in face");
+    _maxVertex = std::max(_maxVertex,iV0);
+    const int64_t iC = iC0+static_cast<int64_t>(j);
+    _sorters->vertices.push({iV0,iC,iC});
+
+    const size_t  k   = (j+1<n)?j+1:0;
+    const int64_t iV1 = face[k];
+    const int64_t iC1 = iC0+static_cast<int64_t>(k);
+    if(iV0<iV1)
+      _sorters->edges.push({iV0,iV1,iC,iC1});
+    else if(iV1<iV0)
+      _sorters->edges.push({iV1,iV0,iC1,iC});
+  }
+  _nC += static_cast<int64_t>(n)+1;
+  _nF++;
+}
+
+void StreamingTopologySummary::end(const int64_t nVertices) {
+  if(!_sorters)
+    throw std::runtime_error("StreamingTopologySummary::end() called before begin()");
+  if(_maxVertex>=nVertices)
+    throw std::runtime_error("vertex index out of range in face");
+  _nV = nVertices;
+
+  Sorters& s = *_sorters;
+
+  // 1) classify the edges by number of incident half edges; the
+  //    records of each edge are consecutive in the sorted stream
+  std::vector<EdgeRecord> edge;
+  auto closeEdge = [&]() {
+    const size_t nH = edge.size();
+    if(nH==0) return;
+    _nE++;
+    if(nH==1) {
+      _nEBoundary++;
+      s.vertices.push({edge[0].v0,-1,-1});
+      s.vertices.push({edge[0].v1,-1,-1});
+    } else if(nH==2) {
+      _nERegular++;
+      s.vertices.push({edge[0].v0,edge[0].c0,edge[1].c0});
+      s.vertices.push({edge[0].v1,edge[0].c1,edge[1].c1});
+    } else {
+      _nESingular++;
+    }
+    edge.clear();
+  };
+  _nRuns = s.edges.getNumberOfRuns();
+  s.edges.merge([&](const EdgeRecord& r) {
+    if(!edge.empty() && (edge[0].v0!=r.v0 || edge[0].v1!=r.v1))
+      closeEdge();
+    edge.push_back(r);
+  });
+  closeEdge();
+
+  // 2) count the corner parts of each vertex, joining the corners
+  //    linked across regular edges; vertices with no records are
+  //    isolated, and are regular internal vertices
+  int64_t                iV       = -1;
+  bool                   boundary = false;
+  std::vector<int64_t>   corner;
+  std::vector<std::pair<int64_t,int64_t>> link;
+  std::vector<int64_t>   parent;
+  auto find = [&](int64_t i) {
+    while(parent[i]!=i)
+      i = parent[i] = parent[parent[i]];
+    return i;
+  };
+  auto closeVertex = [&]() {
+    if(iV<0) return;
+    if(boundary)
+      _nVBoundary++;
+    parent.resize(corner.size());
+    for(size_t i=0;i<corner.size();i++)
+      parent[i] = static_cast<int64_t>(i);
+    int64_t nParts = static_cast<int64_t>(corner.size());
+    for(const auto& [a,b] : link) {
+      const int64_t ia = std::lower_bound(corner.begin(),corner.end(),a)-corner.begin();
+      const int64_t ib = std::lower_bound(corner.begin(),corner.end(),b)-corner.begin();
+      const int64_t ra = find(ia);
+      const int64_t rb = find(ib);
+      if(ra!=rb) {
+        parent[std::max(ra,rb)] = std::min(ra,rb);
+        nParts--;
+      }
+    }
+    if(nParts>1)
+      _nVSingular++;
+    boundary = false;
+    corner.clear();
+    link.clear();
+  };
+  _nRuns += s.vertices.getNumberOfRuns();
+  s.vertices.merge([&](const VertexRecord& r) {
+    if(r.v!=iV) {
+      closeVertex();
+      iV = r.v;
+    }
+    if(r.a<0)
+      boundary = true;
+    else if(r.a==r.b)
+      corner.push_back(r.a);
+    else
+      link.push_back({r.a,r.b});
+  });
+  closeVertex();
+
+  _sorters.reset();
+}
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// StreamingTopologySummary.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef _STREAMING_TOPOLOGY_SUMMARY_HPP_
+#define _STREAMING_TOPOLOGY_SUMMARY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+class StreamingTopologySummary {
+
+  // this class computes the same global counts as MeshTopologySummary
+  // for meshes which do not fit in memory; the faces are streamed in
+  // once, through addFace(), and are never stored
+  //
+  // - every non-degenerate half edge produces one (edge,corners)
+  //   record, and every corner one (vertex,corner) record; the two
+  //   record streams are sorted with external merge sorts, which
+  //   spill sorted runs to temporary files whenever the memory budget
+  //   is exhausted, and merge the runs at the end
+  // - the edges are classified as BOUNDARY, REGULAR, or SINGULAR
+  //   while the sorted edge records are merged; every regular edge
+  //   adds to the vertex stream two records which link the pairs of
+  //   corresponding corners across the edge, and every boundary edge
+  //   two records which label its ends as boundary vertices
+  // - the corner parts of each vertex are then counted while the
+  //   sorted vertex records are merged, with a small Union-Find
+  //   structure which only holds the corners of one vertex
+  // - the vertex and edge indices are int64_t, so that the number of
+  //   vertices and corners is only limited by the disk space
+  // - the memory used is bounded by the budget passed to the
+  //   constructor, plus the corners of the vertex of largest valence
+
+public:
+
+  explicit StreamingTopologySummary(size_t memoryBudget=(size_t(1)<<28));
+  ~StreamingTopologySummary();
+
+  // discard all the records and start a new mesh
+  void begin();
+
+  // - the face is the list of its vertex indices, without the -1
+  //   separator used in coordIndex arrays
+  // - throws std::runtime_error if a vertex index is negative
+  void addFace(std::span<const int64_t> face);
+
+  // - merge the sorted runs and compute the counts; nVertices is the
+  //   number of vertices of the mesh, including isolated vertices
+  // - throws std::runtime_error if a vertex index is out of range, or
+  //   if a temporary file cannot be written or read
+  void end(int64_t nVertices);
+
+  size_t  getMemoryBudget()             const { return _memoryBudget; }
+
+  // number of sorted runs spilled to temporary files by the last
+  // mesh; 0 if all the records fit in the memory budget
+  int     getNumberOfRuns()             const { return _nRuns; }
+
+  int64_t getNumberOfVertices()         const { return _nV; }
+  int64_t getNumberOfEdges()            const { return _nE; }
+  int64_t getNumberOfFaces()            const { return _nF; }
+  int64_t getNumberOfCorners()          const { return _nC; }
+
+  int64_t getNumberOfBoundaryVertices() const { return _nVBoundary; }
+  int64_t getNumberOfInternalVertices() const { return _nV-_nVBoundary; }
+  int64_t getNumberOfRegularVertices()  const { return _nV-_nVSingular; }
+  int64_t getNumberOfSingularVertices() const { return _nVSingular; }
+
+  int64_t getNumberOfBoundaryEdges()    const { return _nEBoundary; }
+  int64_t getNumberOfRegularEdges()     const { return _nERegular; }
+  int64_t getNumberOfSingularEdges()    const { return _nESingular; }
+  int64_t getNumberOfOtherEdges()       const { return _nE-_nEBoundary-_nERegular-_nESingular; }
+
+  // V-E+F
+  int64_t getEulerCharacteristic()      const { return _nV-_nE+_nF; }
+
+  bool    isRegular()                   const { return _nESingular==0 && _nVSingular==0; }
+  bool    hasBoundary()                 const { return _nEBoundary>0; }
+
+private:
+
+  struct Sorters;
+
+  size_t   _memoryBudget;
+  int      _nRuns;
+  int64_t  _maxVertex;
+
+  int64_t  _nV;
+  int64_t  _nE;
+  int64_t  _nF;
+  int64_t  _nC;
+  int64_t  _nVBoundary;
+  int64_t  _nVSingular;
+  int64_t  _nEBoundary;
+  int64_t  _nERegular;
+  int64_t  _nESingular;
+
+  std::unique_ptr<Sorters> _sorters;
+};
+
+#endif // _STREAMING_TOPOLOGY_SUMMARY_HPP_
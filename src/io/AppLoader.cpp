@@ -54,6 +54,11 @@ bool AppLoader::load(const char* filename, SceneGraph& wrl) {
   return success;
 }
 
+AppLoader::~AppLoader() {
+  for(auto& ext_loader : _registry)
+    delete ext_loader.second;
+}
+
 void AppLoader::registerLoader(Loader* loader) {
   if(loader != nullptr) {
     std::string ext(loader->ext()); // constructed from const char*
@@ -46,9 +46,10 @@ class AppLoader {
 public:
 
   AppLoader() {}
-  ~AppLoader() {}
+  ~AppLoader();
 
   bool load(const char* filename, SceneGraph& wrl);
+  // the registered loaders are owned and deleted by the factory
   void registerLoader(Loader* loader);
 
 private:
@@ -54,6 +54,11 @@ bool AppSaver::save(const char* filename, SceneGraph& wrl) {
   return success;
 }
 
+AppSaver::~AppSaver() {
+  for(auto& ext_saver : _registry)
+    delete ext_saver.second;
+}
+
 void AppSaver::registerSaver(Saver* saver) {
   if(saver!=(Saver*)0) {
     string ext(saver->ext()); // constructed from const char*
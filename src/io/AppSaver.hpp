@@ -46,9 +46,10 @@ class AppSaver {
 public:
 
   AppSaver() {}
-  ~AppSaver() {}
+  ~AppSaver();
 
   bool save(const char* filename, SceneGraph& wrl);
+  // the registered savers are owned and deleted by the factory
   void registerSaver(Saver* saver);
 
 private:
@@ -42,10 +42,14 @@
 // #include <stdio.h>
 #include "LoaderPly.hpp"
 
+#include <charconv>
+#include <cstring>
 #include <iostream>
 
 #include "TokenizerFile.hpp"
 #include "TokenizerString.hpp"
+#include "util/MappedFile.hpp"
+#include "util/Parallel.hpp"
 #include "wrl/Appearance.hpp"
 #include "wrl/ImageTexture.hpp"
 #include "wrl/IndexedFaceSetPly.hpp"
@@ -54,733 +58,1026 @@
 
 const char* LoaderPly::_ext = "ply";
 
-//////////////////////////////////////////////////////////////////////
-// static
-Ply::DataType LoaderPly::systemEndian() {
-  return Endian::isLittleEndianSystem() ? Ply::DataType::BINARY_LITTLE_ENDIAN :  Ply::DataType::BINARY_BIG_ENDIAN;
+bool LoaderPly::_memoryMap = true;
+
+void LoaderPly::setMemoryMap(const bool value) {
+  _memoryMap = value;
 }
 
-//////////////////////////////////////////////////////////////////////
-// static
-bool LoaderPly::sameAsSystemEndian(Ply::DataType fileEndian) {
-   return (fileEndian==systemEndian());
+bool LoaderPly::getMemoryMap() {
+  return _memoryMap;
 }
 
-//////////////////////////////////////////////////////////////////////
-// static
-void LoaderPly::addBinaryValue(Endian::SingleValueBuffer& buff,
-  const Ply::Element::Property::Type propertyType,
-  const bool swapBytes,
-  void* value) {
-
-  switch(propertyType) {
-  case Ply::Element::Property::CHAR:
-  case Ply::Element::Property::INT8:
-    {
-      std::vector<char>* valueChar= static_cast<std::vector<char>*>(value);
-      char v = buff.c[0];
-      valueChar->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::UCHAR:
-  case Ply::Element::Property::UINT8:
-    {
-      std::vector<uchar>* valueUChar= static_cast<std::vector<uchar>*>(value);
-      uchar v = buff.uc[0];
-      valueUChar->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::SHORT:
-  case Ply::Element::Property::INT16:
-    {
-      std::vector<short>* valueShort= static_cast<std::vector<short>*>(value);
+namespace {
+
+  bool skipFile(FILE* fp, const int64_t nBytes) {
+#ifdef _WIN32
+    return _fseeki64(fp,nBytes,SEEK_CUR)==0;
+#else
+    return fseeko(fp,static_cast<off_t>(nBytes),SEEK_CUR)==0;
+#endif
+  }
+
+  // reads a binary file in blocks of 1MB, so that small values can be
+  // read without one fread() call per value, and skips large ranges
+  // of bytes with 64 bit seeks; a reader constructed on a block of
+  // memory, such as a memory mapped file, returns pointers into the
+  // block, and never copies
+  class BlockReader {
+
+  public:
+
+    explicit BlockReader(FILE* fp):
+      _fp(fp),
+      _data(nullptr),
+      _buffer(size_t(1)<<20),
+      _pos(0),
+      _end(0),
+      _nBytesRead(0) {
+    }
+
+    BlockReader(const char* data, const size_t size):
+      _fp(nullptr),
+      _data(data),
+      _buffer(),
+      _pos(0),
+      _end(size),
+      _nBytesRead(0) {
+    }
+
+    int64_t getNumberOfBytesRead() const { return _nBytesRead; }
+
+    // returns a pointer to the next n bytes, which remains valid until
+    // the next call to read() or skip()
+    const char* read(const size_t n) {
+      if(_end-_pos<n)
+        _fill(n);
+      const char* p = ((_data)?_data:_buffer.data())+_pos;
+      _pos        += n;
+      _nBytesRead += static_cast<int64_t>(n);
+      return p;
+    }
+
+    // returns a pointer to the next nLines lines of text, which
+    // remains valid until the next call to read(), readLines(), or
+    // skip(), and sets end past the '\n' of the last one; the last
+    // line of the file may have no '\n'
+    const char* readLines(const size_t nLines, const char*& end) {
+      size_t scan = _pos;
+      for(size_t iLine=0;iLine<nLines;iLine++) {
+        for(;;) {
+          const char* base = (_data)?_data:_buffer.data();
+          const void* eol  = std::memchr(base+scan,'\n',_end-scan);
+          if(eol) {
+            scan = static_cast<size_t>(static_cast<const char*>(eol)-base)+1;
+            break;
+          }
+          if(_more(scan)==false) {
+            if(scan<_end) {
+              scan = _end;
+              break;
+            }
+            char s[128]; snprintf(s,128,"found empty record %zu",iLine);
+            throw std::runtime_error(string(s));
+          }
+        }
+      }
+      const char* base = (_data)?_data:_buffer.data();
+      const char* p    = base+_pos;
+      _nBytesRead += static_cast<int64_t>(scan-_pos);
+      _pos = scan;
+      end  = base+scan;
+      return p;
+    }
+
+    void skip(int64_t n) {
+      _nBytesRead += n;
+      const int64_t nBuffered = static_cast<int64_t>(_end-_pos);
+      if(n<=nBuffered) {
+        _pos += static_cast<size_t>(n);
+        return;
+      }
+      if(_data)
+        throw std::runtime_error("unexpected end of file");
+      n -= nBuffered;
+      _pos = _end = 0;
+      if(!skipFile(_fp,n))
+        throw std::runtime_error("unexpected end of file");
+    }
+
+  private:
+
+    void _fill(const size_t n) {
+      if(_data)
+        throw std::runtime_error("unexpected end of file");
+      std::memmove(_buffer.data(),_buffer.data()+_pos,_end-_pos);
+      _end -= _pos;
+      _pos  = 0;
+      if(_buffer.size()<n)
+        _buffer.resize(n);
+      _end += fread(_buffer.data()+_end,1,_buffer.size()-_end,_fp);
+      if(_end<n)
+        throw std::runtime_error("unexpected end of file");
+    }
+
+    // read more bytes into the buffer, keeping the bytes from _pos on,
+    // and moving them to the front; offset, a position in the buffer,
+    // is moved with them; returns false at the end of the file
+    bool _more(size_t& offset) {
+      if(_data)
+        return false;
+      std::memmove(_buffer.data(),_buffer.data()+_pos,_end-_pos);
+      offset -= _pos;
+      _end   -= _pos;
+      _pos    = 0;
+      if(_end==_buffer.size())
+        _buffer.resize(2*_buffer.size());
+      const size_t n = fread(_buffer.data()+_end,1,_buffer.size()-_end,_fp);
+      _end += n;
+      return n>0;
+    }
+
+    FILE*             _fp;
+    const char*       _data;
+    std::vector<char> _buffer;
+    size_t            _pos;
+    size_t            _end;
+    int64_t           _nBytesRead;
+  };
+
+  // decode one binary integer value of the given type
+  int64_t decodeInteger(const char* p,
+                        const Ply::Element::Property::Type type,
+                        const bool swapBytes) {
+    Endian::SingleValueBuffer buff;
+    std::memcpy(buff.c,p,static_cast<size_t>(Ply::Element::Property::getTypeSize(type)));
+    switch(type) {
+    case Ply::Element::Property::CHAR:
+    case Ply::Element::Property::INT8:
+      return buff.c[0];
+    case Ply::Element::Property::UCHAR:
+    case Ply::Element::Property::UINT8:
+      return buff.uc[0];
+    case Ply::Element::Property::SHORT:
+    case Ply::Element::Property::INT16:
       if(swapBytes) Endian::swapShort(buff);
-      short v = buff.s[0];
-      valueShort->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::USHORT:
-  case Ply::Element::Property::UINT16:
-    {
-      std::vector<ushort>* valueUShort= static_cast<std::vector<ushort>*>(value);
+      return buff.s[0];
+    case Ply::Element::Property::USHORT:
+    case Ply::Element::Property::UINT16:
       if(swapBytes) Endian::swapUShort(buff);
-      ushort v = buff.us[0];
-      valueUShort->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::INT:
-  case Ply::Element::Property::INT32:
-    {
-      std::vector<int>* valueInt= static_cast<std::vector<int>*>(value);
+      return buff.us[0];
+    case Ply::Element::Property::INT:
+    case Ply::Element::Property::INT32:
       if(swapBytes) Endian::swapInt(buff);
-      int v = buff.i[0];
-      valueInt->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::UINT:
-  case Ply::Element::Property::UINT32:
-    {
-      std::vector<uint>* valueUInt= static_cast<std::vector<uint>*>(value);
+      return buff.i[0];
+    case Ply::Element::Property::UINT:
+    case Ply::Element::Property::UINT32:
       if(swapBytes) Endian::swapUInt(buff);
-      uint v = buff.ui[0];
-      valueUInt->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::FLOAT:
-  case Ply::Element::Property::FLOAT32:
-  case Ply::Element::Property::FLOAT32_2:
-  case Ply::Element::Property::FLOAT32_3:
-    {
-      std::vector<float>* valueFloat = static_cast<std::vector<float>*>(value);
-      if(swapBytes) Endian::swapFloat(buff);
-      float v = buff.f[0];
-      valueFloat->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::DOUBLE:
-  case Ply::Element::Property::FLOAT64:
-    {
-      std::vector<double>* valueDouble = static_cast<std::vector<double>*>(value);
-      if(swapBytes) Endian::swapDouble(buff);
-      double v = buff.d[0];
-      valueDouble->push_back(v);
-    }
-    break; 
-  case Ply::Element::Property::NONE:
-    {
-      throw std::runtime_error("unexpected NONE binary value tyde");
+      return buff.ui[0];
+    default:
+      throw std::runtime_error("expecting integer type");
     }
   }
-}
 
-//////////////////////////////////////////////////////////////////////
-// static
-void LoaderPly::addAsciiValue(const string& token,
-  const Ply::Element::Property::Type propertyType,
-  void* value) {
-
-  switch(propertyType) {
-  case Ply::Element::Property::CHAR:
-  case Ply::Element::Property::INT8:
-    {
-      std::vector<char>* valueChar= static_cast<std::vector<char>*>(value);
-      char v = static_cast<char>(atoi(token.c_str()));
-      valueChar->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::UCHAR:
-  case Ply::Element::Property::UINT8:
-    {
-      std::vector<uchar>* valueUChar= static_cast<std::vector<uchar>*>(value);
-      uchar v = static_cast<uchar>(atoi(token.c_str()));
-      valueUChar->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::SHORT:
-  case Ply::Element::Property::INT16:
-    {
-      std::vector<short>* valueShort= static_cast<std::vector<short>*>(value);
-      short v = static_cast<short>(atoi(token.c_str()));
-      valueShort->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::USHORT:
-  case Ply::Element::Property::UINT16:
-    {
-      std::vector<ushort>* valueUShort= static_cast<std::vector<ushort>*>(value);
-      ushort v = static_cast<ushort>(atoi(token.c_str()));
-      valueUShort->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::INT:
-  case Ply::Element::Property::INT32:
-    {
-      std::vector<int>* valueInt= static_cast<std::vector<int>*>(value);
-      int v = static_cast<int>(atoi(token.c_str()));
-      valueInt->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::UINT:
-  case Ply::Element::Property::UINT32:
-    {
-      std::vector<uint>* valueUInt= static_cast<std::vector<uint>*>(value);
-      uint v = static_cast<uint>(atol(token.c_str()));
-      valueUInt->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::FLOAT:
-  case Ply::Element::Property::FLOAT32:
-  case Ply::Element::Property::FLOAT32_2:
-  case Ply::Element::Property::FLOAT32_3:
-    {
-      std::vector<float>* valueFloat = static_cast<std::vector<float>*>(value);
-      float v = static_cast<float>(atof(token.c_str()));
-      valueFloat->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::DOUBLE:
-  case Ply::Element::Property::FLOAT64:
-    {
-      std::vector<double>* valueDouble = static_cast<std::vector<double>*>(value);
-      double v = static_cast<double>(atof(token.c_str()));
-      valueDouble->push_back(v);
-    }
-    break;
-  case Ply::Element::Property::NONE:
-    {
-      throw std::runtime_error("unexpected NONE ascii value type");
+  template<class S>
+  inline S loadValue(const char* p, const bool swapBytes) {
+    S v;
+    if(swapBytes) {
+      char b[sizeof(S)];
+      for(size_t i=0;i<sizeof(S);i++)
+        b[i] = p[sizeof(S)-1-i];
+      std::memcpy(&v,b,sizeof(S));
+    } else {
+      std::memcpy(&v,p,sizeof(S));
     }
+    return v;
   }
-}
-
-//////////////////////////////////////////////////////////////////////
-// returns number of bytes read
-size_t LoaderPly::readHeader(FILE* fp, Ply& ply, const string indent) {
 
-  (void) indent;
-
-  // APP->log(QString(indent.c_str())+"LoaderPly::readHeader() {");
+  // decoder of one property of the file
+  // - the value of a scalar property for record iRecord is stored in
+  //   dst[first+iRecord*dim+component], where dst is the data of the
+  //   property vector, presized for all the records of the element
+  // - the values of a list property are appended to the vector
+  // - in wrlMode, the (x,y,z), (nx,ny,nz), (red,green,blue), and
+  //   (u,v) properties are packed as components of the coord, normal,
+  //   color, and texCoord float vectors, and vertex_indices are
+  //   appended to coordIndex as int, followed by -1
+  struct Column {
+    Ply::Element::Property::Type type;      // in the file
+    Ply::Element::Property::Type listType;  // NONE if not a list
+    size_t                       size;      // bytes per value in the file
+    size_t                       offset;    // in fixed size records
+    Ply::Element::Property*      property;
+    size_t                       dim;
+    size_t                       component;
+    size_t                       first;
+    bool                         wrl;
+    bool                         color;
+    bool                         coordIndex;
+
+    bool isList() const { return listType!=Ply::Element::Property::NONE; }
+  };
+
+  Column makeColumn(Ply::Element& element, const LoaderPly::FileProperty& fileProperty) {
+
+    static const struct { const char* name; const char* packed; size_t component; } wrlPacking[] = {
+      {"x","coord",0}, {"y","coord",1}, {"z","coord",2},
+      {"nx","normal",0}, {"ny","normal",1}, {"nz","normal",2},
+      {"red","color",0}, {"green","color",1}, {"blue","color",2},
+      {"u","texCoord",0}, {"v","texCoord",1},
+      {"vertex_indices","coordIndex",0}
+    };
+
+    Column c;
+    c.type       = fileProperty.type;
+    c.listType   = (fileProperty.list)?fileProperty.listType:Ply::Element::Property::NONE;
+    c.size       = static_cast<size_t>(Ply::Element::Property::getTypeSize(fileProperty.type));
+    c.offset     = 0;
+    c.property   = element.getProperty(fileProperty.name);
+    c.dim        = 1;
+    c.component  = 0;
+    c.first      = 0;
+    c.wrl        = false;
+    c.color      = false;
+    c.coordIndex = false;
+
+    // properties not found by name were packed by addProperty in wrlMode
+    if(c.property==nullptr) {
+      for(const auto& packing : wrlPacking) {
+        if(fileProperty.name!=packing.name) continue;
+        c.property  = element.getProperty(packing.packed);
+        c.component = packing.component;
+        break;
+      }
+      if(c.property==nullptr)
+        throw std::runtime_error("no property for "+fileProperty.name);
+      const Ply::Element::Property::Type type = c.property->getPropertyType();
+      c.dim        = (type==Ply::Element::Property::FLOAT32_3)?3:
+                     (type==Ply::Element::Property::FLOAT32_2)?2:1;
+      c.wrl        = true;
+      c.color      = (c.property->getName()=="color");
+      c.coordIndex = (c.property->getName()=="coordIndex");
+    }
 
-  size_t nBytes = 0;
-  if(fp) {
-    TokenizerFile ftkn(fp);
+    return c;
+  }
 
-    // read first line
-    if(ftkn.getline()==false)
-      throw std::runtime_error("cannot read first line");
+  // append n default values to the vector of the property, and
+  // return the previous size of the vector
+  size_t growValue(Ply::Element::Property& property, const size_t n) {
+    const size_t first = property.getNumberOfValues();
+    property.resize(first+n);
+    return first;
+  }
 
-    // first line should be "ply"
-    if(ftkn.compare(0,3,"ply")!=0)
-      throw std::runtime_error("this is not a ply file");
+  // decode n values, stride bytes apart, of a scalar column, for the
+  // records iRecord,...,iRecord+n-1
+  template<class S>
+  void scatterColumn(const char* src, const size_t stride, const size_t n,
+                     const bool swapBytes, const Column& c, const size_t iRecord) {
+    if(c.wrl) {
+      float* dst = c.property->as<float>().data()+c.first+iRecord*c.dim+c.component;
+      if(c.color) {
+        for(size_t i=0;i<n;i++)
+          dst[i*c.dim] = static_cast<float>(loadValue<S>(src+i*stride,swapBytes))/255.0f;
+      } else {
+        for(size_t i=0;i<n;i++)
+          dst[i*c.dim] = static_cast<float>(loadValue<S>(src+i*stride,swapBytes));
+      }
+    } else {
+      S* dst = c.property->as<S>().data()+c.first+iRecord;
+      for(size_t i=0;i<n;i++)
+        dst[i] = loadValue<S>(src+i*stride,swapBytes);
+    }
+  }
 
-    // APP->log(QString("%1  ply").arg(indent.c_str()));
+  void decodeScalars(const char* src, const size_t stride, const size_t n,
+                     const bool swapBytes, const Column& c, const size_t iRecord) {
+    switch(c.type) {
+    case Ply::Element::Property::CHAR:
+    case Ply::Element::Property::INT8:
+      scatterColumn<char>(src,stride,n,swapBytes,c,iRecord); break;
+    case Ply::Element::Property::UCHAR:
+    case Ply::Element::Property::UINT8:
+      scatterColumn<unsigned char>(src,stride,n,swapBytes,c,iRecord); break;
+    case Ply::Element::Property::SHORT:
+    case Ply::Element::Property::INT16:
+      scatterColumn<short>(src,stride,n,swapBytes,c,iRecord); break;
+    case Ply::Element::Property::USHORT:
+    case Ply::Element::Property::UINT16:
+      scatterColumn<unsigned short>(src,stride,n,swapBytes,c,iRecord); break;
+    case Ply::Element::Property::INT:
+    case Ply::Element::Property::INT32:
+      scatterColumn<int>(src,stride,n,swapBytes,c,iRecord); break;
+    case Ply::Element::Property::UINT:
+    case Ply::Element::Property::UINT32:
+      scatterColumn<unsigned int>(src,stride,n,swapBytes,c,iRecord); break;
+    case Ply::Element::Property::FLOAT:
+    case Ply::Element::Property::FLOAT32:
+      scatterColumn<float>(src,stride,n,swapBytes,c,iRecord); break;
+    case Ply::Element::Property::DOUBLE:
+    case Ply::Element::Property::FLOAT64:
+      scatterColumn<double>(src,stride,n,swapBytes,c,iRecord); break;
+    default:
+      throw std::runtime_error("unexpected binary value type");
+    }
+  }
 
-    // second line should be "format"
-    if(ftkn.getline()==false)
-      throw std::runtime_error("cannot read scond line");
+  template<class S>
+  void appendList(const char* src, const size_t n, const bool swapBytes, const Column& c) {
+    if(c.coordIndex) {
+      std::vector<int>& v = c.property->getVector<int>();
+      const size_t first = v.size();
+      v.resize(first+n+1);
+      for(size_t i=0;i<n;i++)
+        v[first+i] = static_cast<int>(loadValue<S>(src+i*sizeof(S),swapBytes));
+      v[first+n] = -1;
+    } else {
+      std::vector<S>& v = c.property->getVector<S>();
+      const size_t first = v.size();
+      v.resize(first+n);
+      for(size_t i=0;i<n;i++)
+        v[first+i] = loadValue<S>(src+i*sizeof(S),swapBytes);
+      c.property->pushBackList(static_cast<int>(n));
+    }
+  }
 
-    if(ftkn == "format ascii 1.0")
-      ply._dataType = Ply::DataType::ASCII;
-    else if(ftkn == "format binary_little_endian 1.0")
-      ply._dataType = Ply::DataType::BINARY_LITTLE_ENDIAN;
-    else if(ftkn == "format binary_big_endian 1.0")
-      ply._dataType = Ply::DataType::BINARY_BIG_ENDIAN;
-    else
-      throw std::runtime_error("cannot parse second line");
+  void decodeList(const char* src, const size_t n, const bool swapBytes, const Column& c) {
+    switch(c.type) {
+    case Ply::Element::Property::CHAR:
+    case Ply::Element::Property::INT8:
+      appendList<char>(src,n,swapBytes,c); break;
+    case Ply::Element::Property::UCHAR:
+    case Ply::Element::Property::UINT8:
+      appendList<unsigned char>(src,n,swapBytes,c); break;
+    case Ply::Element::Property::SHORT:
+    case Ply::Element::Property::INT16:
+      appendList<short>(src,n,swapBytes,c); break;
+    case Ply::Element::Property::USHORT:
+    case Ply::Element::Property::UINT16:
+      appendList<unsigned short>(src,n,swapBytes,c); break;
+    case Ply::Element::Property::INT:
+    case Ply::Element::Property::INT32:
+      appendList<int>(src,n,swapBytes,c); break;
+    case Ply::Element::Property::UINT:
+    case Ply::Element::Property::UINT32:
+      appendList<unsigned int>(src,n,swapBytes,c); break;
+    case Ply::Element::Property::FLOAT:
+    case Ply::Element::Property::FLOAT32:
+      appendList<float>(src,n,swapBytes,c); break;
+    case Ply::Element::Property::DOUBLE:
+    case Ply::Element::Property::FLOAT64:
+      appendList<double>(src,n,swapBytes,c); break;
+    default:
+      throw std::runtime_error("unexpected binary value type");
+    }
+  }
 
-    // APP->log(QString("%1  format %2")
-    //          .arg(indent.c_str())
-    //          .arg(ply.getDataTypeName().c_str()));
+  // compile the decoder of one element, with one column per property
+  // of the file; returns the size in bytes of the records, which is
+  // only meaningful if none of the properties is a list
+  size_t compileColumns(Ply::Element& element, const LoaderPly::FileElement& fileElement,
+                        std::vector<Column>& column, bool& hasList) {
+    size_t stride = 0;
+    hasList = false;
+    column.clear();
+    for(const LoaderPly::FileProperty& fileProperty : fileElement.property) {
+      Column c = makeColumn(element,fileProperty);
+      c.offset = stride;
+      stride  += c.size;
+      hasList |= c.isList();
+      column.push_back(c);
+    }
+    return stride;
+  }
 
-    Ply::Element* element = nullptr;
+  // presize the vectors of the scalar properties for nRecords more
+  // records, and set the first value of each column
+  void presizeColumns(std::vector<Column>& column, const size_t nRecords) {
+    for(size_t i=0;i<column.size();i++) {
+      if(column[i].isList()) continue;
+      size_t j = 0; // first column of the same property
+      while(column[j].property!=column[i].property) j++;
+      column[i].first = (j<i)?column[j].first:
+        growValue(*column[i].property,nRecords*static_cast<size_t>(column[i].dim));
+    }
+  }
 
-    while(ftkn.get()) {
+  // reserve the list values of a full load of nRecords records; list
+  // sizes are not known from the header, and the vertex indices of
+  // faces are reserved for triangles, with the -1 separators of
+  // coordIndex
+  // - only the full load paths reserve storage for the whole file;
+  //   header parsing and the streaming paths do not allocate it
+  void reserveLists(std::vector<Column>& column, const size_t nRecords) {
+    for(Column& c : column) {
+      if(c.isList()==false) continue;
+      const std::string& name = c.property->getName();
+      const size_t nList = (name=="coordIndex")?4:(name=="vertex_indices")?3:0;
+      c.property->reserve(nList*nRecords,nRecords);
+    }
+  }
 
-      if(ftkn.equals("end_header")) {
+  // decode the next nRecords binary records of one element, into
+  // columns presized by presizeColumns(column,nRecords)
+  void decodeBinaryRecords(BlockReader& reader, const std::vector<Column>& column,
+                           const size_t stride, const bool hasList,
+                           const size_t nRecords, const bool swapBytes) {
+
+    if(hasList==false) {
+
+      // fixed size records are decoded in blocks, one column at a
+      // time, with no per value dispatch
+      const size_t nBlock = std::max<size_t>((size_t(1)<<20)/std::max<size_t>(stride,1),1);
+      for(size_t iRecord=0;iRecord<nRecords;iRecord+=nBlock) {
+        const size_t n     = std::min(nBlock,nRecords-iRecord);
+        const char*  block = reader.read(n*stride);
+        for(const Column& c : column)
+          decodeScalars(block+c.offset,stride,n,swapBytes,c,iRecord);
+      }
 
-        // APP->log(QString("%1  end_header").arg(indent.c_str()));
+    } else {
 
-        break;
+      // variable size records are decoded one record at a time, from
+      // the same block buffer
+      for(size_t iRecord=0;iRecord<nRecords;iRecord++) {
+        for(const Column& c : column) {
+          if(c.isList()) {
+            const int64_t nList =
+              decodeInteger(reader.read(static_cast<size_t>(Ply::Element::Property::getTypeSize(c.listType))),
+                            c.listType,swapBytes);
+            if(nList<0)
+              throw std::runtime_error("negative list size");
+            decodeList(reader.read(static_cast<size_t>(nList)*c.size),
+                       static_cast<size_t>(nList),swapBytes,c);
+          } else {
+            decodeScalars(reader.read(c.size),0,1,swapBytes,c,iRecord);
+          }
+        }
+      }
+    }
+  }
 
-      } else if(ftkn=="obj_info") {
+  // decode the records of all the elements into the properties of
+  // ply, following the file layout; returns the number of bytes read
+  size_t decodeBinaryData(BlockReader& reader, Ply& ply,
+                          const std::vector<LoaderPly::FileElement>& layout,
+                          const bool swapBytes) {
+
+    std::vector<Column> column;
+
+    const int nElements = static_cast<int>(layout.size());
+    for(int iElement=0;iElement<nElements;iElement++) {
+      const LoaderPly::FileElement& fileElement = layout[static_cast<size_t>(iElement)];
+      const size_t nRecords = static_cast<size_t>(fileElement.nRecords);
+      bool hasList;
+      const size_t stride =
+        compileColumns(*ply.getElement(iElement),fileElement,column,hasList);
+      presizeColumns(column,nRecords);
+      reserveLists(column,nRecords);
+      decodeBinaryRecords(reader,column,stride,hasList,nRecords,swapBytes);
+    }
 
-        // APP->log(QString("%1  obj_info").arg(indent.c_str()));
+    return static_cast<size_t>(reader.getNumberOfBytesRead());
+  }
 
-        if(ftkn.getline()==false)
-          throw std::runtime_error("cannot read rest of line");
+  // ascii data
+  // - the records are lines, and the values of a record are separated
+  //   by blanks; the numbers are parsed with std::from_chars, as
+  //   double, which represents all the PLY integer values exactly,
+  //   and converted to the type of the property as atoi and atof did
 
-        // APP->log(QString("%1    \"%2\"").arg(indent.c_str()).arg(ftkn.c_str()));
+  inline bool isBlank(const char c) {
+    return (c==' ' || c=='\t' || c==',' || c=='\r');
+  }
 
-        ply.addObjInfo(ftkn);
+  // parse the next number of the line which ends at end; returns
+  // nullptr if there is none
+  inline const char* parseNumber(const char* p, const char* end, double& value) {
+    while(p<end && isBlank(*p)) p++;
+    if(p<end && *p=='+') p++; // not accepted by from_chars
+    const std::from_chars_result r = std::from_chars(p,end,value);
+    if(r.ec!=std::errc() || (r.ptr<end && isBlank(*r.ptr)==false))
+      return nullptr;
+    return r.ptr;
+  }
 
-      } else if(ftkn=="comment") {
+  template<class S>
+  inline S convertValue(const double value) {
+    if constexpr (std::is_floating_point_v<S>)
+      return static_cast<S>(value);
+    else
+      return static_cast<S>(static_cast<int64_t>(value));
+  }
 
-        if(ftkn.getline()==false)
-          throw std::runtime_error("cannot read rest of line");
+  template<class S>
+  inline void storeScalar(const Column& c, const size_t iRecord, const double value) {
+    c.property->as<S>()[c.first+iRecord] = convertValue<S>(value);
+  }
 
-        // length("TextureFile")=11
-        if(ftkn.compare(0,11,"TextureFile")==0) {
+  void storeAsciiScalar(const Column& c, const size_t iRecord, const double value) {
+    if(c.wrl) {
+      float* dst = c.property->as<float>().data();
+      const float v = convertValue<float>(value);
+      dst[c.first+iRecord*c.dim+c.component] = (c.color)?v/255.0f:v;
+      return;
+    }
+    switch(c.type) {
+    case Ply::Element::Property::CHAR:
+    case Ply::Element::Property::INT8:    storeScalar<char>(c,iRecord,value); break;
+    case Ply::Element::Property::UCHAR:
+    case Ply::Element::Property::UINT8:   storeScalar<unsigned char>(c,iRecord,value); break;
+    case Ply::Element::Property::SHORT:
+    case Ply::Element::Property::INT16:   storeScalar<short>(c,iRecord,value); break;
+    case Ply::Element::Property::USHORT:
+    case Ply::Element::Property::UINT16:  storeScalar<unsigned short>(c,iRecord,value); break;
+    case Ply::Element::Property::INT:
+    case Ply::Element::Property::INT32:   storeScalar<int>(c,iRecord,value); break;
+    case Ply::Element::Property::UINT:
+    case Ply::Element::Property::UINT32:  storeScalar<unsigned int>(c,iRecord,value); break;
+    case Ply::Element::Property::FLOAT:
+    case Ply::Element::Property::FLOAT32: storeScalar<float>(c,iRecord,value); break;
+    case Ply::Element::Property::DOUBLE:
+    case Ply::Element::Property::FLOAT64: storeScalar<double>(c,iRecord,value); break;
+    default:
+      throw std::runtime_error("unexpected ascii value type");
+    }
+  }
 
-          // skip white space
-          ulong i=12; for(;isspace(ftkn[i]);i++);
-          // rest of line is file name
-          string textureFile = ftkn.substr(i,ftkn.length()-i);
-          ply.setTextureFile(textureFile);
+  // the list values of one column parsed by one chunk of records,
+  // which are appended to the property in chunk order
+  struct AsciiList {
+    std::vector<int>    size;
+    std::vector<double> value;
+  };
+
+  template<class S>
+  void appendAsciiList(const Column& c, const AsciiList& list) {
+    if(c.coordIndex) {
+      std::vector<int>& v = c.property->getVector<int>();
+      size_t i = v.size(), k = 0;
+      v.resize(i+list.value.size()+list.size.size());
+      for(const int n : list.size) {
+        for(int j=0;j<n;j++)
+          v[i++] = convertValue<int>(list.value[k++]);
+        v[i++] = -1;
+      }
+    } else {
+      std::vector<S>& v = c.property->getVector<S>();
+      size_t i = v.size();
+      v.resize(i+list.value.size());
+      for(const double value : list.value)
+        v[i++] = convertValue<S>(value);
+      for(const int n : list.size)
+        c.property->pushBackList(n);
+    }
+  }
 
-          // APP->log(QString("%1  TextureFile \"%2\"")
-          //          .arg(indent.c_str())
-          //          .arg(textureFile.c_str()));
+  void appendAsciiList(const Column& c, const AsciiList& list) {
+    switch(c.type) {
+    case Ply::Element::Property::CHAR:
+    case Ply::Element::Property::INT8:    appendAsciiList<char>(c,list); break;
+    case Ply::Element::Property::UCHAR:
+    case Ply::Element::Property::UINT8:   appendAsciiList<unsigned char>(c,list); break;
+    case Ply::Element::Property::SHORT:
+    case Ply::Element::Property::INT16:   appendAsciiList<short>(c,list); break;
+    case Ply::Element::Property::USHORT:
+    case Ply::Element::Property::UINT16:  appendAsciiList<unsigned short>(c,list); break;
+    case Ply::Element::Property::INT:
+    case Ply::Element::Property::INT32:   appendAsciiList<int>(c,list); break;
+    case Ply::Element::Property::UINT:
+    case Ply::Element::Property::UINT32:  appendAsciiList<unsigned int>(c,list); break;
+    case Ply::Element::Property::FLOAT:
+    case Ply::Element::Property::FLOAT32: appendAsciiList<float>(c,list); break;
+    case Ply::Element::Property::DOUBLE:
+    case Ply::Element::Property::FLOAT64: appendAsciiList<double>(c,list); break;
+    default:
+      throw std::runtime_error("unexpected ascii value type");
+    }
+  }
 
+  // parse the records iRecord0<=iRecord<iRecord1 of one element, the
+  // first one starting at p; the list values are returned in list,
+  // one per column
+  void parseAsciiRecords(const char* p, const char* end,
+                         const size_t iRecord0, const size_t iRecord1,
+                         const std::vector<Column>& column,
+                         std::vector<AsciiList>& list) {
+    double value;
+    for(size_t iRecord=iRecord0;iRecord<iRecord1;iRecord++) {
+
+      // one record per line
+      const char* eol = static_cast<const char*>(std::memchr(p,'\n',static_cast<size_t>(end-p)));
+      if(eol==nullptr) eol = end;
+
+      for(size_t i=0;i<column.size();i++) {
+        const Column& c = column[i];
+        if((p = parseNumber(p,eol,value))==nullptr) {
+          char s[128];
+          snprintf(s,128,"end of line in property record %zu",iRecord);
+          throw std::runtime_error(s);
+        }
+        if(c.isList()) {
+          // negative list sizes, which the previous reader accepted,
+          // are read as empty lists
+          const int nList = std::max(convertValue<int>(value),0);
+          list[i].size.push_back(nList);
+          for(int j=0;j<nList;j++) {
+            if((p = parseNumber(p,eol,value))==nullptr) {
+              char s[128];
+              snprintf(s,128,"end of line in property record %zu",iRecord);
+              throw std::runtime_error(s);
+            }
+            list[i].value.push_back(value);
+          }
         } else {
+          storeAsciiScalar(c,iRecord,value);
+        }
+      }
 
-          // APP->log(QString("%1  comment").arg(indent.c_str()));
-
-          // APP->log(QString("%1    \"%2\"")
-          //          .arg(indent.c_str())
-          //          .arg(ftkn.c_str()));
-
-          if(ply._skipComments==false) {
-            ply.addComment(ftkn);
-          }
+      p = (eol<end)?eol+1:end;
+    }
+  }
 
+  // decode the ascii records of all the elements into the properties
+  // of ply, following the file layout; returns the number of bytes
+  // decoded
+  // - the record lines of each element are found with a memchr scan,
+  //   and split into contiguous chunks, which are parsed concurrently
+  //   with Parallel::run(); the scalar values are stored in place, by
+  //   record index, and the list values are appended in chunk order
+  size_t decodeAsciiData(const char* data, const size_t size, Ply& ply,
+                         const std::vector<LoaderPly::FileElement>& layout) {
+
+    using FileElement  = LoaderPly::FileElement;
+
+    const char* end = data+size;
+    const char* p   = data;
+
+    std::vector<Column> column;
+
+    const int nElements = static_cast<int>(layout.size());
+    for(int iElement=0;iElement<nElements;iElement++) {
+      const FileElement& fileElement = layout[static_cast<size_t>(iElement)];
+      Ply::Element*      element     = ply.getElement(iElement);
+      const size_t       nRecords    = static_cast<size_t>(fileElement.nRecords);
+
+      // 1) compile the element decoder, as for binary data
+      bool hasList;
+      compileColumns(*element,fileElement,column,hasList);
+      presizeColumns(column,nRecords);
+      reserveLists(column,nRecords);
+
+      // 2) find the first line of each chunk, and the end of the element
+      const int nChunks = std::max(Parallel::getNumberOfChunks(static_cast<int64_t>(nRecords),1<<12),1);
+      std::vector<size_t>      chunkRecord(static_cast<size_t>(nChunks)+1);
+      std::vector<const char*> chunkBegin(static_cast<size_t>(nChunks)+1);
+      for(int iChunk=0;iChunk<=nChunks;iChunk++)
+        chunkRecord[static_cast<size_t>(iChunk)] = nRecords*static_cast<size_t>(iChunk)/static_cast<size_t>(nChunks);
+      size_t iChunk = 0;
+      for(size_t iRecord=0;iRecord<nRecords;iRecord++) {
+        while(iChunk<static_cast<size_t>(nChunks) && chunkRecord[iChunk]==iRecord)
+          chunkBegin[iChunk++] = p;
+        if(p>=end) {
+          char s[128]; snprintf(s,128,"found empty record %zu",iRecord);
+          throw std::runtime_error(string(s));
         }
+        const char* eol = static_cast<const char*>(std::memchr(p,'\n',static_cast<size_t>(end-p)));
+        p = (eol)?eol+1:end;
+      }
+      while(iChunk<=static_cast<size_t>(nChunks))
+        chunkBegin[iChunk++] = p;
+
+      // 3) parse the chunks; exceptions are passed to the calling thread
+      std::vector<std::vector<AsciiList>> list(static_cast<size_t>(nChunks),
+                                               std::vector<AsciiList>(column.size()));
+      std::vector<std::string> error(static_cast<size_t>(nChunks));
+      Parallel::run(nChunks,[&](const int i) {
+        const size_t k = static_cast<size_t>(i);
+        try {
+          parseAsciiRecords(chunkBegin[k],chunkBegin[k+1],chunkRecord[k],chunkRecord[k+1],
+                            column,list[k]);
+        } catch(const std::exception& e) {
+          error[k] = e.what();
+        }
+      });
+      for(const std::string& e : error)
+        if(e.empty()==false)
+          throw std::runtime_error(e);
+
+      // 4) append the list values in chunk order
+      for(size_t i=0;i<column.size();i++)
+        if(column[i].isList())
+          for(const std::vector<AsciiList>& chunkList : list)
+            appendAsciiList(column[i],chunkList[i]);
+    }
 
-      } else if(ftkn=="element") {
-
-        if(ftkn.get()==false)
-          throw std::runtime_error("expecting element name");
-         string elementName = ftkn;
+    return static_cast<size_t>(p-data);
+  }
 
-        if(ftkn.get()==false)      
-          throw std::runtime_error("expecting element nRecords");
-        int nRecords = atoi(ftkn.c_str());
-        if(nRecords<0)
-          throw std::runtime_error("expecting non-negative element nRecords");
-    
-        // APP->log(QString("%1  element %2 %3")
-        //          .arg(indent.c_str())
-        //          .arg(elementName.c_str())
-        //          .arg(nRecords));
-    
-        element = ply.addElement(elementName,nRecords);
+} // namespace
 
-      } else if(ftkn=="property") {
+//////////////////////////////////////////////////////////////////////
+// static
+Ply::DataType LoaderPly::systemEndian() {
+  return Endian::isLittleEndianSystem() ? Ply::DataType::BINARY_LITTLE_ENDIAN :  Ply::DataType::BINARY_BIG_ENDIAN;
+}
 
-        bool                         list;
-        Ply::Element::Property::Type listType;
-        Ply::Element::Property::Type propertyType;
-        string                       propertyName;
-    
-        if(ftkn.get()==false)      
-          throw std::runtime_error("early end of property");
+//////////////////////////////////////////////////////////////////////
+// static
+bool LoaderPly::sameAsSystemEndian(Ply::DataType fileEndian) {
+   return (fileEndian==systemEndian());
+}
 
-        if(ftkn.equals("list")) {
+//////////////////////////////////////////////////////////////////////
+// returns number of bytes read
+size_t LoaderPly::readHeader(FILE* fp, Ply& ply, const string indent,
+                             std::vector<FileElement>* layout) {
 
-          list = true;
+  // APP->log(QString(indent.c_str())+"LoaderPly::readHeader() {");
 
-          if(ftkn.get()==false)      
-            throw std::runtime_error("expecting listType");
+  size_t nBytes = 0;
+  if(fp) {
+    TokenizerFile ftkn(fp);
+    parseHeader(ftkn,ply,indent,layout);
+    nBytes = static_cast<size_t>(ftell(fp));
+  }
 
-          listType = Ply::Element::Property::parseType(ftkn);
+  // APP->log(QString(indent.c_str())+"}");
 
-          if(ftkn.get()==false)      
-            throw std::runtime_error("expecting propertyType");
+  return nBytes;
+}
 
-          propertyType = Ply::Element::Property::parseType(ftkn);
+//////////////////////////////////////////////////////////////////////
+// static
+size_t LoaderPly::readHeader(const char* data, const size_t size, Ply& ply,
+                             const string indent, std::vector<FileElement>* layout) {
+
+  // the header ends with the first end_header line; the search is
+  // bounded, so that the data of a file without header is not scanned
+  const std::string_view text(data,std::min<size_t>(size,size_t(1)<<24));
+  size_t nBytes = text.find("\nend_header");
+  if(nBytes==std::string_view::npos)
+    throw std::runtime_error("end_header not found");
+  nBytes += 11;
+  if(nBytes<size && data[nBytes]=='\r') nBytes++;
+  if(nBytes<size && data[nBytes]=='\n') nBytes++;
+
+  TokenizerString ftkn(string(data,nBytes));
+  parseHeader(ftkn,ply,indent,layout);
 
-          if(ftkn.get()==false)      
-            throw std::runtime_error("expecting property name");
+  return nBytes;
+}
 
-          propertyName = ftkn;
+//////////////////////////////////////////////////////////////////////
+// static
+void LoaderPly::parseHeader(Tokenizer& ftkn, Ply& ply, const string indent,
+                            std::vector<FileElement>* layout) {
 
-          // APP->log(QString("%1    property list %2 %3 %4")
-          //          .arg(indent.c_str())
-          //          .arg(Ply::Element::Property::getTypeName(listType).c_str())
-          //          .arg(Ply::Element::Property::getTypeName(propertyType).c_str())
-          //          .arg(propertyName.c_str()));
+  (void) indent;
 
-        } else {
+  // read first line
+  if(ftkn.getline()==false)
+    throw std::runtime_error("cannot read first line");
 
-          list     = false;
-          listType = Ply::Element::Property::Type::NONE;
+  // first line should be "ply"
+  if(ftkn.compare(0,3,"ply")!=0)
+    throw std::runtime_error("this is not a ply file");
 
-          propertyType = Ply::Element::Property::parseType(ftkn);
+  // APP->log(QString("%1  ply").arg(indent.c_str()));
 
-          if(ftkn.get()==false)      
-            throw std::runtime_error("expecting property name");
+  // second line should be "format"
+  if(ftkn.getline()==false)
+    throw std::runtime_error("cannot read scond line");
 
-          propertyName = ftkn;
+  if(ftkn == "format ascii 1.0")
+    ply._dataType = Ply::DataType::ASCII;
+  else if(ftkn == "format binary_little_endian 1.0")
+    ply._dataType = Ply::DataType::BINARY_LITTLE_ENDIAN;
+  else if(ftkn == "format binary_big_endian 1.0")
+    ply._dataType = Ply::DataType::BINARY_BIG_ENDIAN;
+  else
+    throw std::runtime_error("cannot parse second line");
 
-          // APP->log(QString("%1    property %2 %3")
-          //          .arg(indent.c_str())
-          //          .arg(Ply::Element::Property::getTypeName(propertyType).c_str())
-          //          .arg(propertyName.c_str()));
+  // APP->log(QString("%1  format %2")
+  //          .arg(indent.c_str())
+  //          .arg(ply.getDataTypeName().c_str()));
 
-        }
+  Ply::Element* element = nullptr;
 
-        element->addProperty(propertyName,list,listType,propertyType);
+  while(ftkn.get()) {
 
-      } else {
-        if(ftkn.getline()==false)
-          throw std::runtime_error("cannot read rest of line");
+    if(ftkn.equals("end_header")) {
 
-        // APP->log(QString("%1  line=\"%2\"")
-        //          .arg(indent.c_str())
-        //          .arg(ftkn.c_str()));
+      // APP->log(QString("%1  end_header").arg(indent.c_str()));
 
-      }
-    }
-    nBytes = static_cast<size_t>(ftell(fp));
-  }
+      break;
 
-  // APP->log(QString(indent.c_str())+"}");
+    } else if(ftkn=="obj_info") {
 
-  return nBytes;
-}
+      // APP->log(QString("%1  obj_info").arg(indent.c_str()));
 
-//////////////////////////////////////////////////////////////////////
-// static
-size_t LoaderPly::readBinaryData(FILE* fp, Ply& ply, const string indent) {
+      if(ftkn.getline()==false)
+        throw std::runtime_error("cannot read rest of line");
 
-  (void)indent;
+      // APP->log(QString("%1    \"%2\"").arg(indent.c_str()).arg(ftkn.c_str()));
 
-  // APP->log(QString(indent.c_str())+"LoaderPly::readBinaryData() {");
+      ply.addObjInfo(ftkn);
 
-  size_t nBytesData = 0;
-  if(fp) {
-    long fp0 = ftell(fp);
-
-    int                     nElements,iElement,nProperties,iProperty;
-    int                     nRecords,iRecord,k0,k1,i;
-    int                     nList,nBytesListCount, nBytesListValue;
-    int                     nBytesValue,nBytesRead,nBytesRecord;
-    string                  name;
-    string                  propertyName;
-    void*                   value        = nullptr;
-    Ply::DataType           dataType     = ply.getDataType();
-    Ply::Element*           element      = nullptr;
-    Ply::Element::Property* property     = nullptr;
-    Ply::Element::Property::Type propertyType = Ply::Element::Property::Type::NONE;
-    Ply::Element::Property::Type listType     = Ply::Element::Property::Type::NONE;
+    } else if(ftkn=="comment") {
 
-    Endian::SingleValueBuffer buff;
+      if(ftkn.getline()==false)
+        throw std::runtime_error("cannot read rest of line");
 
-    bool swapBytes = (sameAsSystemEndian(dataType)==false);
-    // bool little  = (dataType==Ply::DataType::BINARY_LITTLE_ENDIAN);
+      // length("TextureFile")=11
+      if(ftkn.compare(0,11,"TextureFile")==0) {
 
-    // APP->log(QString("%1  dataType  = %2")
-    //          .arg(indent.c_str()).arg(Ply::getDataTypeName(dataType).c_str()));
-    // APP->log(QString("%1  swapBytes  = %2")
-    //          .arg(indent.c_str()).arg((swapBytes)?"true":"false"));
+        // skip white space
+        ulong i=12; for(;isspace(ftkn[i]);i++);
+        // rest of line is file name
+        string textureFile = ftkn.substr(i,ftkn.length()-i);
+        ply.setTextureFile(textureFile);
 
-    nElements = ply.getNumberOfElements();
-    // APP->log(QString("%1  nElements = %2").arg(indent.c_str()).arg(nElements));
+        // APP->log(QString("%1  TextureFile \"%2\"")
+        //          .arg(indent.c_str())
+        //          .arg(textureFile.c_str()));
 
-    bool wrlMode = ply.getWrlMode();
+      } else {
 
-    for(iElement=0;iElement<nElements;iElement++) {
-      element = ply.getElement(iElement);
-      name    = element->getName();
+        // APP->log(QString("%1  comment").arg(indent.c_str()));
 
-      // APP->log(QString("%1    element %2 name = %3")
-      //          .arg(indent.c_str())
-      //          .arg(iElement)
-      //          .arg(name.c_str()));
+        // APP->log(QString("%1    \"%2\"")
+        //          .arg(indent.c_str())
+        //          .arg(ftkn.c_str()));
 
-      nProperties = element->getNumberOfProperties();
-      // APP->log(QString("%1      nProperties = %2")
-      //          .arg(indent.c_str())
-      //          .arg(nProperties));
-
-      for(iProperty=0;iProperty<nProperties;iProperty++) {
-        property     = element->getProperty(iProperty);
-        propertyName = property->getName();
-        propertyType = property->getPropertyType();
-        if(property->isList()==true) {
-          listType = property->getListType();
-          // APP->log(QString("%1      property[%2] = %3:list(%4,%5)")
-          //          .arg(indent.c_str())
-          //          .arg(iProperty)
-          //          .arg(propertyName.c_str())
-          //          .arg(Ply::Element::Property::getTypeName(listType).c_str())
-          //          .arg(Ply::Element::Property::getTypeName(propertyType).c_str()));
-        } else {
-          // APP->log(QString("%1      property[%2] = %3:%4")
-          //          .arg(indent.c_str())
-          //          .arg(iProperty)
-          //          .arg(propertyName.c_str())
-          //          .arg(Ply::Element::Property::getTypeName(propertyType).c_str()));
+        if(ply._skipComments==false) {
+          ply.addComment(ftkn);
         }
+
       }
 
-      nRecords = element->getNumberOfRecords();
-      // APP->log(QString("%1      nRecords = %2")
+    } else if(ftkn=="element") {
+
+      if(ftkn.get()==false)
+        throw std::runtime_error("expecting element name");
+       string elementName = ftkn;
+
+      if(ftkn.get()==false)      
+        throw std::runtime_error("expecting element nRecords");
+      int nRecords = atoi(ftkn.c_str());
+      if(nRecords<0)
+        throw std::runtime_error("expecting non-negative element nRecords");
+  
+      // APP->log(QString("%1  element %2 %3")
       //          .arg(indent.c_str())
+      //          .arg(elementName.c_str())
       //          .arg(nRecords));
+  
+      element = ply.addElement(elementName,nRecords);
+      if(layout)
+        layout->push_back({elementName,nRecords,{}});
 
-      k0 = 0;
-      for(iRecord=0;iRecord<nRecords;iRecord++) {
-        nBytesRecord = 0;
-        for(iProperty=0;iProperty<nProperties;iProperty++) {
+    } else if(ftkn=="property") {
 
-          property     = element->getProperty(iProperty);
-          propertyName = property->getName();
-          propertyType = property->getPropertyType();
-          value        = property->getValue();
+      bool                         list;
+      Ply::Element::Property::Type listType;
+      Ply::Element::Property::Type propertyType;
+      string                       propertyName;
+  
+      if(ftkn.get()==false)      
+        throw std::runtime_error("early end of property");
 
-          if(property->isList()) {
-            nBytesListCount = property->getListTypeSize();
-            nBytesListValue = property->getPropertyTypeSize();
+      if(ftkn.equals("list")) {
 
-            // number of elements in the list
+        list = true;
 
-            nBytesRead =
-              static_cast<int>
-              (fread(&(buff.c),1,static_cast<size_t>(nBytesListCount),fp));
+        if(ftkn.get()==false)      
+          throw std::runtime_error("expecting listType");
 
-            if(nBytesRead<nBytesListCount) {
-              char s[128]; snprintf(s,128,"end of file in record %d",iRecord);
-              throw std::runtime_error(string(s));
-            }
+        listType = Ply::Element::Property::parseType(ftkn);
 
-            nBytesRecord += nBytesRead;
+        if(ftkn.get()==false)      
+          throw std::runtime_error("expecting propertyType");
 
-            nList = 0;
-            listType = property->getListType();
-            switch(listType) {
-            case Ply::Element::Property::Type::CHAR:
-            case Ply::Element::Property::Type::INT8:
-              nList = static_cast<int>(buff.c[0]&0xff);
-              break;
-            case Ply::Element::Property::Type::UCHAR:
-            case Ply::Element::Property::Type::UINT8:
-              nList = static_cast<int>(buff.uc[0]&0xff);
-              break;
-            case Ply::Element::Property::Type::SHORT:
-            case Ply::Element::Property::Type::INT16:
-              nList = static_cast<int>(buff.s[0]&0xff);
-              break;
-            case Ply::Element::Property::Type::USHORT:
-            case Ply::Element::Property::Type::UINT16:
-              nList = static_cast<int>(buff.us[0]&0xff);
-              break;
-            case Ply::Element::Property::Type::INT:
-            case Ply::Element::Property::Type::INT32:
-              nList = static_cast<int>(buff.i[0]&0xff);
-              break;
-            case Ply::Element::Property::Type::UINT:
-            case Ply::Element::Property::Type::UINT32:
-              nList = static_cast<int>(buff.ui[0]&0xff);
-              break;
-            default:
-              throw std::runtime_error("unexpected list type");
-            }
+        propertyType = Ply::Element::Property::parseType(ftkn);
 
-            if(wrlMode==false || propertyName!="coordIndex")
-              property->pushBackList(nList);
+        if(ftkn.get()==false)      
+          throw std::runtime_error("expecting property name");
 
-            // read nList values, each of length nBytesListValue
+        propertyName = ftkn;
 
-            for(i=0;i<nList;i++) {
-              nBytesRead =
-                static_cast<int>
-                (fread(&(buff.c),1,static_cast<size_t>(nBytesListValue),fp));
-              if(nBytesRead<nBytesListValue) {
-                char s[128]; snprintf(s,128,"end of file in record %d",iRecord);
-                throw std::runtime_error(string(s));
-              }
+        // APP->log(QString("%1    property list %2 %3 %4")
+        //          .arg(indent.c_str())
+        //          .arg(Ply::Element::Property::getTypeName(listType).c_str())
+        //          .arg(Ply::Element::Property::getTypeName(propertyType).c_str())
+        //          .arg(propertyName.c_str()));
 
-              nBytesRecord += nBytesRead;
+      } else {
 
-              addBinaryValue(buff,propertyType,swapBytes,value);
-            }
+        list     = false;
+        listType = Ply::Element::Property::Type::NONE;
 
-            if(wrlMode && propertyName=="coordIndex")
-              static_cast<vector<int>*>(value)->push_back(-1);
-
-          } else /* if(property.isList()==false) */ {
-
-            nBytesValue = property->getPropertyTypeSize();
-            if(wrlMode) {
-              int n =
-                (propertyType==Ply::Element::Property::Type::FLOAT32_3)?3:
-                (propertyType==Ply::Element::Property::Type::FLOAT32_2)?2:1;
-            
-              if(propertyName=="color")
-                nBytesValue = 1;
-              else
-                nBytesValue /= n;
-
-              while((--n)>=0) {
-                nBytesRead =
-                  static_cast<int>
-                  (fread(&(buff.c),1,static_cast<size_t>(nBytesValue),fp));
-                if(nBytesRead<nBytesValue) {
-                  char s[128]; snprintf(s,128,"end of file in record %d",iRecord);
-                  throw std::runtime_error(string(s));
-                }
-
-                nBytesRecord += nBytesRead;
-
-                if(wrlMode && propertyName=="color") {
-                  vector<float>* colorValue = static_cast<vector<float>*>(value);
-                  colorValue->push_back(static_cast<float>(buff.uc[0])/255.0f);
-                } else {
-                  addBinaryValue(buff,propertyType,swapBytes,value);
-                }
-              }
-
-            } else {
-
-              nBytesRead =
-                static_cast<int>
-                (fread(&(buff.c),1,static_cast<size_t>(nBytesValue),fp));
-              if(nBytesRead<nBytesValue) {
-                char s[128]; snprintf(s,128,"end of file in record %d",iRecord);
-                throw std::runtime_error(string(s));
-              }
-              nBytesRecord += nBytesRead;
-              addBinaryValue(buff,propertyType,swapBytes,value);
+        propertyType = Ply::Element::Property::parseType(ftkn);
 
-            }
-          }
+        if(ftkn.get()==false)      
+          throw std::runtime_error("expecting property name");
 
-        } // for(iProperty=0;iProperty<nProperties;iProperty++)
+        propertyName = ftkn;
 
-        // report progress
-        k1 = (10*(iRecord+1))/nRecords;
-        if(k1>k0) {
-          char s[128];
-          snprintf(s,128,"        %3d %%",10*k1);
-          // APP->log(QString(indent.c_str())+s);
-          k0 = k1;
-        }
+        // APP->log(QString("%1    property %2 %3")
+        //          .arg(indent.c_str())
+        //          .arg(Ply::Element::Property::getTypeName(propertyType).c_str())
+        //          .arg(propertyName.c_str()));
 
-      } // } for(iRecord=0;iRecord<nRecords;iRecord++)
-    } // } for(iElement=0;iElement<nElements;iElement++)
+      }
 
-    long fp1 = ftell(fp);
-    nBytesData = static_cast<size_t>(fp1-fp0);
-  }
+      if(element==nullptr)
+        throw std::runtime_error("property before first element");
 
-  // APP->log(QString(indent.c_str())+"} LoaderPly::readBinaryData()");
+      element->addProperty(propertyName,list,listType,propertyType);
+      if(layout)
+        layout->back().property.push_back({propertyName,list,listType,propertyType});
 
-  return nBytesData;
+    } else {
+      if(ftkn.getline()==false)
+        throw std::runtime_error("cannot read rest of line");
+
+      // APP->log(QString("%1  line=\"%2\"")
+      //          .arg(indent.c_str())
+      //          .arg(ftkn.c_str()));
+
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////
 // static
-size_t LoaderPly::readAsciiData(FILE* fp, Ply& ply, const std::string indent) {
+size_t LoaderPly::readBinaryData(FILE* fp, Ply& ply,
+                                 const std::vector<FileElement>& layout,
+                                 const string indent) {
 
   (void)indent;
 
-  // APP->log(QString("%1LoaderPly::readAsciiData() {").arg(indent.c_str()));
+  // APP->log(QString(indent.c_str())+"LoaderPly::readBinaryData() {");
 
-  size_t nBytes = 0;
+  size_t nBytesData = 0;
   if(fp) {
-    long fp0 = ftell(fp);
-    TokenizerFile ftkn(fp);
+    BlockReader reader(fp);
+    nBytesData = decodeBinaryData(reader,ply,layout,sameAsSystemEndian(ply.getDataType())==false);
+  }
 
-    int nElements = ply.getNumberOfElements();
-    // APP->log(QString("%1  nElements = %2")
-    //          .arg(indent.c_str())
-    //          .arg(nElements));
-
-    Ply::Element* element;
-    Ply::Element::Property* property;
-    // Ply::Element::Property::Type listType = Ply::Element::Property::Type::NONE;
-    Ply::Element::Property::Type propertyType = Ply::Element::Property::Type::NONE;
-    void* value;
-    string line,name,propertyName,token;
-    int i,iElement,iProperty,iRecord,k0,k1,nList,nProperties,nRecords;
-
-    bool wrlMode = ply.getWrlMode();
-
-    for(iElement=0;iElement<nElements;iElement++) {
-       element = ply.getElement(iElement);
-
-       name    = element->getName();
-       // APP->log(QString("%1    name =\"%2\"")
-       //          .arg(indent.c_str())
-       //          .arg(name.c_str()));
-
-       nProperties = element->getNumberOfProperties();
-       // APP->log(QString("%1      nProperties = %2")
-       //          .arg(indent.c_str())
-       //          .arg(nProperties));
-
-       nRecords = element->getNumberOfRecords();
-       // APP->log(QString("%1      nRecords = %2")
-       //          .arg(indent.c_str())
-       //          .arg(nRecords));
-
-       k0 = 0;
-       for(iRecord=0;iRecord<nRecords;iRecord++) {
-
-          // one record per line
-          if(ftkn.getline()==false) {
-            char s[128]; snprintf(s,128,"found empty record %d",iRecord);
-            throw std::runtime_error(string(s));
-          }
+  // APP->log(QString(indent.c_str())+"} LoaderPly::readBinaryData()");
 
-          TokenizerString stkn(ftkn);
+  return nBytesData;
+}
 
-          for(iProperty=0;iProperty<nProperties;iProperty++) {
+//////////////////////////////////////////////////////////////////////
+// static
+size_t LoaderPly::readBinaryData(const char* data, const size_t size, Ply& ply,
+                                 const std::vector<FileElement>& layout,
+                                 const string indent) {
+  (void)indent;
+  BlockReader reader(data,size);
+  return decodeBinaryData(reader,ply,layout,sameAsSystemEndian(ply.getDataType())==false);
+}
 
-            property     = element->getProperty(iProperty);
-            propertyName = property->getName();
-            propertyType = property->getPropertyType();
-  
-            if(property->isList()==true) {
- 
-              nList = 0;
-
-              if(stkn.get()==false) {
-                char s[128];
-                snprintf(s,128,"end of line in property record %d",iRecord);
-                throw std::runtime_error(s);
-              }
-
-              nList = atoi(stkn.c_str());
-
-              if(wrlMode==false || propertyName!="coordIndex")
-                property->pushBackList(nList);
- 
-              value = property->getValue();
-  
-               for(i=0;i<nList;i++) {
-                 if(stkn.get()==false) {
-                   char s[128];
-                   snprintf(s,128,"end of line in property record %d",iRecord);
-                   throw std::runtime_error(string(s));
-                 }
-                 addAsciiValue(stkn,propertyType,value);
-               }
-
-               if(wrlMode && propertyName=="coordIndex")
-                 static_cast<vector<int>*>(value)->push_back(-1);
-
-            } else /* if(property.isList()==false) */ {
-
-              value = property->getValue();
- 
-              int n =
-                (propertyType==Ply::Element::Property::Type::FLOAT32_3)?3:
-                (propertyType==Ply::Element::Property::Type::FLOAT32_2)?2:1;
-
-              while(--n>=0) {
-                if(stkn.get()==false) {
-                  char s[128];
-                  snprintf(s,128,"end of line in property record %d",iRecord);
-                  throw std::runtime_error(string(s));
-                }
-                addAsciiValue(stkn,propertyType,value);
-                if(wrlMode && propertyName=="color") {
-                    static_cast<vector<float>*>(value)->back() /= 255.0;
-                }
-              }
-            }
-          }
+//////////////////////////////////////////////////////////////////////
+// static
+size_t LoaderPly::readAsciiData(FILE* fp, Ply& ply,
+                                const std::vector<FileElement>& layout,
+                                const std::string indent) {
 
-          // report progress
-          k1 = (10*(iRecord+1))/nRecords;
-          if(k1>k0) {
-            char s[128];
-            snprintf(s,128,"        %3d %%",10*k1);
-            // APP->log(QString(indent.c_str())+s);
-            k0 = k1;
-          }
+  (void)indent;
 
-      } // for(iRecord=0;iRecord<nRecords;iRecord++)
-    } // for(iElement=0;iElement<nElements;iElement++)
+  // APP->log(QString("%1LoaderPly::readAsciiData() {").arg(indent.c_str()));
 
-    long fp1 = ftell(fp);
-    nBytes = static_cast<size_t>(fp1-fp0);
+  size_t nBytes = 0;
+  if(fp) {
+    // read the rest of the file in large blocks
+    std::vector<char> data;
+    size_t size = 0;
+    for(;;) {
+      data.resize(size+(size_t(1)<<20));
+      const size_t n = fread(data.data()+size,1,data.size()-size,fp);
+      size += n;
+      if(n==0) break;
+    }
+    nBytes = readAsciiData(data.data(),size,ply,layout,indent);
   }
+
   // APP->log(QString(indent.c_str())+"} LoaderPly::readAsciiData()");
   return nBytes;
 }
 
+//////////////////////////////////////////////////////////////////////
+// static
+size_t LoaderPly::readAsciiData(const char* data, const size_t size, Ply& ply,
+                                const std::vector<FileElement>& layout,
+                                const string indent) {
+  (void)indent;
+  return decodeAsciiData(data,size,ply,layout);
+}
+
 //////////////////////////////////////////////////////////////////////
 // static
 bool LoaderPly::load(const char* filename, Ply & ply, const std::string indent) {
@@ -795,14 +1092,35 @@ bool LoaderPly::load(const char* filename, Ply & ply, const std::string indent)
   ply.clear();
   try {
 
-    // open the file for ascii reading
     if(filename==nullptr)
       throw std::runtime_error("no filename");
+
+    // decode the data straight from a memory mapping, opening the
+    // file once
+    if(_memoryMap) {
+      MappedFile file;
+      if(file.open(filename)) {
+        std::vector<FileElement> layout;
+        const size_t nBytesHeader =
+          readHeader(file.getData(),file.getSize(),ply,indent+"  ",&layout);
+        if(ply.getDataType()==Ply::DataType::ASCII)
+          readAsciiData(file.getData()+nBytesHeader,file.getSize()-nBytesHeader,
+                        ply,layout,indent+"  ");
+        else
+          readBinaryData(file.getData()+nBytesHeader,file.getSize()-nBytesHeader,
+                         ply,layout,indent+"  ");
+        ply.logInfo(std::cout,indent+"  ");
+        return true;
+      }
+    }
+
+    // open the file for ascii reading
     fp = fopen(filename,"r");
     if(fp==nullptr)
       throw std::runtime_error("unable to open file for ascii reading");
 
-    size_t nBytesHeader = readHeader(fp,ply,indent+"  ");
+    std::vector<FileElement> layout;
+    size_t nBytesHeader = readHeader(fp,ply,indent+"  ",&layout);
 
     // APP->log(QString("%1  nBytesHeader = %2")
     //          .arg(indent.c_str())
@@ -812,7 +1130,7 @@ bool LoaderPly::load(const char* filename, Ply & ply, const std::string indent)
 
     if(ply.getDataType()==Ply::DataType::ASCII) {
       // continue reading ascii data from the same FileInputStream
-      nBytesData = readAsciiData(fp,ply,indent+"  ");
+      nBytesData = readAsciiData(fp,ply,layout,indent+"  ");
 
       // APP->log(QString("%1  nBytesData(ASCII) = %2")
       //          .arg(indent.c_str())
@@ -831,7 +1149,7 @@ bool LoaderPly::load(const char* filename, Ply & ply, const std::string indent)
       if(fseek(fp,static_cast<long>(nBytesHeader),SEEK_SET)!=0)
         throw std::runtime_error("failed to skip header to read binary data");
 
-      nBytesData = readBinaryData(fp,ply,indent+"  ");
+      nBytesData = readBinaryData(fp,ply,layout,indent+"  ");
 
       // APP->log(QString("%1  nBytesData(BINARY) = %2")
       //          .arg(indent.c_str())
@@ -860,6 +1178,227 @@ bool LoaderPly::load(const char* filename, Ply & ply, const std::string indent)
   return success;
 }
 
+//////////////////////////////////////////////////////////////////////
+// static
+bool LoaderPly::loadFaces(const char* filename, int64_t& nVertices,
+                          const std::function<void(std::span<const int64_t>)>& face) {
+
+  bool success = false;
+  nVertices = 0;
+
+  FILE* fp = nullptr;
+  try {
+
+    if(filename==nullptr)
+      throw std::runtime_error("no filename");
+    fp = fopen(filename,"r");
+    if(fp==nullptr)
+      throw std::runtime_error("unable to open file for ascii reading");
+
+    // the records are skipped using the layout of the file, which is
+    // not changed by the wrlMode conversions
+    Ply ply;
+    std::vector<FileElement> layout;
+    const size_t nBytesHeader = readHeader(fp,ply,"",&layout);
+    fclose(fp);
+    fp = nullptr;
+
+    if(ply.getDataType()==Ply::DataType::ASCII)
+      throw std::runtime_error("only binary files can be streamed");
+
+    int iFace  = -1;
+    int iIndex = -1;
+    for(size_t i=0;i<layout.size();i++) {
+      if(layout[i].name=="vertex")
+        nVertices = layout[i].nRecords;
+      if(layout[i].name!="face")
+        continue;
+      iFace = static_cast<int>(i);
+      for(size_t j=0;j<layout[i].property.size();j++) {
+        const FileProperty& fileProperty = layout[i].property[j];
+        if(fileProperty.list &&
+           (fileProperty.name=="vertex_indices" || fileProperty.name=="vertex_index"))
+          iIndex = static_cast<int>(j);
+      }
+    }
+    if(iFace<0 || iIndex<0)
+      throw std::runtime_error("no face:vertex_indices list property");
+
+    fp = fopen(filename,"rb");
+    if(fp==nullptr)
+      throw std::runtime_error("unable to open file to read binary data");
+    if(fseek(fp,static_cast<long>(nBytesHeader),SEEK_SET)!=0)
+      throw std::runtime_error("failed to skip header to read binary data");
+
+    const bool swapBytes = (sameAsSystemEndian(ply.getDataType())==false);
+
+    BlockReader          reader(fp);
+    std::vector<int64_t> index;
+
+    for(int iElement=0;iElement<static_cast<int>(layout.size());iElement++) {
+      const FileElement& element  = layout[static_cast<size_t>(iElement)];
+      const int64_t      nRecords = element.nRecords;
+
+      // the records of elements without list properties have a fixed
+      // size, and are skipped all at once
+      bool    hasList      = false;
+      int64_t nBytesRecord = 0;
+      for(const FileProperty& fileProperty : element.property) {
+        hasList |= fileProperty.list;
+        nBytesRecord += Ply::Element::Property::getTypeSize(fileProperty.type);
+      }
+      if(hasList==false) {
+        reader.skip(nBytesRecord*nRecords);
+        continue;
+      }
+
+      const int nProperties = static_cast<int>(element.property.size());
+      for(int64_t iRecord=0;iRecord<nRecords;iRecord++) {
+        for(int iProperty=0;iProperty<nProperties;iProperty++) {
+          const FileProperty& fileProperty = element.property[static_cast<size_t>(iProperty)];
+          const int nBytesValue = Ply::Element::Property::getTypeSize(fileProperty.type);
+          if(fileProperty.list==false) {
+            reader.skip(nBytesValue);
+            continue;
+          }
+
+          const int64_t nList =
+            decodeInteger(reader.read(static_cast<size_t>(Ply::Element::Property::getTypeSize(fileProperty.listType))),
+                          fileProperty.listType,swapBytes);
+          if(nList<0)
+            throw std::runtime_error("negative list size");
+
+          if(iElement==iFace && iProperty==iIndex) {
+            const char* p = reader.read(static_cast<size_t>(nList*nBytesValue));
+            index.resize(static_cast<size_t>(nList));
+            for(int64_t i=0;i<nList;i++)
+              index[static_cast<size_t>(i)] = decodeInteger(p+i*nBytesValue,fileProperty.type,swapBytes);
+          } else {
+            reader.skip(nList*nBytesValue);
+          }
+        }
+        if(iElement==iFace)
+          face(index);
+      }
+    }
+
+    success = true;
+
+  } catch(const std::exception& /* e */) {
+    // APP->log(QString("  %1").arg(e.what()));
+  }
+
+  if(fp) fclose(fp);
+
+  return success;
+}
+
+//////////////////////////////////////////////////////////////////////
+// static
+bool LoaderPly::loadRecords(const char* filename,
+                            const std::map<std::string,RecordVisitor>& visitor,
+                            const int batchSize) {
+
+  bool success   = false;
+  bool inVisitor = false;
+
+  FILE* fp = nullptr;
+  try {
+
+    if(filename==nullptr)
+      throw std::runtime_error("no filename");
+    if(batchSize<=0)
+      throw std::runtime_error("batchSize must be positive");
+    fp = fopen(filename,"rb");
+    if(fp==nullptr)
+      throw std::runtime_error("unable to open file");
+
+    // the properties of the elements of ply hold the values of one
+    // batch at a time; parsing the header does not allocate them
+    Ply ply;
+    std::vector<FileElement> layout;
+    const size_t nBytesHeader = readHeader(fp,ply,"",&layout);
+    if(fseek(fp,static_cast<long>(nBytesHeader),SEEK_SET)!=0)
+      throw std::runtime_error("failed to skip header");
+
+    const bool ascii     = (ply.getDataType()==Ply::DataType::ASCII);
+    const bool swapBytes = (ascii==false && sameAsSystemEndian(ply.getDataType())==false);
+    const size_t nBatch  = static_cast<size_t>(batchSize);
+
+    BlockReader            reader(fp);
+    std::vector<Column>    column;
+    std::vector<AsciiList> list;
+
+    for(int iElement=0;iElement<static_cast<int>(layout.size());iElement++) {
+      const FileElement& fileElement = layout[static_cast<size_t>(iElement)];
+      Ply::Element&      element     = *ply.getElement(iElement);
+      const size_t       nRecords    = static_cast<size_t>(fileElement.nRecords);
+      const auto         v           = visitor.find(fileElement.name);
+      const bool         visited     = (v!=visitor.end());
+
+      bool hasList;
+      const size_t stride = compileColumns(element,fileElement,column,hasList);
+
+      // fixed size binary records of elements with no visitor are
+      // skipped all at once
+      if(visited==false && ascii==false && hasList==false) {
+        reader.skip(static_cast<int64_t>(stride*nRecords));
+        continue;
+      }
+
+      list.assign(column.size(),AsciiList());
+      for(size_t iRecord=0;iRecord<nRecords;iRecord+=nBatch) {
+        const size_t n = std::min(nBatch,nRecords-iRecord);
+        const char*  end;
+        if(ascii && visited==false) {
+          reader.readLines(n,end);
+          continue;
+        }
+
+        for(int iProperty=0;iProperty<element.getNumberOfProperties();iProperty++)
+          element.getProperty(iProperty)->clear();
+        presizeColumns(column,n);
+
+        if(ascii) {
+          const char* p = reader.readLines(n,end);
+          parseAsciiRecords(p,end,0,n,column,list);
+          for(size_t i=0;i<column.size();i++) {
+            if(column[i].isList()==false) continue;
+            appendAsciiList(column[i],list[i]);
+            list[i].size.clear();
+            list[i].value.clear();
+          }
+        } else {
+          decodeBinaryRecords(reader,column,stride,hasList,n,swapBytes);
+        }
+
+        if(visited) {
+          inVisitor = true;
+          v->second(element,static_cast<int64_t>(iRecord),static_cast<int>(n));
+          inVisitor = false;
+        }
+      }
+
+      for(int iProperty=0;iProperty<element.getNumberOfProperties();iProperty++)
+        element.getProperty(iProperty)->clear(true);
+    }
+
+    success = true;
+
+  } catch(const std::exception& /* e */) {
+    // APP->log(QString("  %1").arg(e.what()));
+    // the exceptions thrown by the visitors are the caller's
+    if(inVisitor) {
+      if(fp) fclose(fp);
+      throw;
+    }
+  }
+
+  if(fp) fclose(fp);
+
+  return success;
+}
+
 //////////////////////////////////////////////////////////////////////
 bool LoaderPly::load(const char* filename, SceneGraph& sceneGraph) {
 
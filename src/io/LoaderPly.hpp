@@ -42,6 +42,13 @@
 #pragma once
 
 #include "Loader.hpp"
+#include "Tokenizer.hpp"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
 #include <util/Endian.hpp>
 #include <wrl/Ply.hpp>
 #include <wrl/SceneGraph.hpp>
@@ -50,9 +57,31 @@ class LoaderPly : public Loader {
 
 private:
 
+  friend class MappedPly;
+
   const static char* _ext;
 
+  /// default : true
+  static bool _memoryMap;
+
 public:
+
+  // the properties of one element as they are laid out in the file,
+  // before the wrlMode conversions of Ply::Element::addProperty,
+  // which merge and rename some of them
+  struct FileProperty {
+    std::string                  name;
+    bool                         list;
+    Ply::Element::Property::Type listType;
+    Ply::Element::Property::Type type;
+  };
+
+  struct FileElement {
+    std::string               name;
+    int                       nRecords;
+    std::vector<FileProperty> property;
+  };
+
   LoaderPly() = default;
   ~LoaderPly() override = default;
 
@@ -61,17 +90,71 @@ public:
 
   static bool load(const char* filename, Ply & ply, std::string indent="");
 
+  // - if enabled, binary and ASCII files are decoded straight from
+  //   a read-only memory mapping of the file (see util/MappedFile.hpp),
+  //   with no intermediate copies; files which cannot be mapped are
+  //   read with stdio
+  // - the records of ASCII files are parsed in chunks, on
+  //   Parallel::getNumberOfThreads() threads
+  static void setMemoryMap(bool value);
+  static bool getMemoryMap();
+
+  // stream the faces of a binary PLY file, without storing them, for
+  // meshes which do not fit in memory
+  // - nVertices is set to the number of vertex records before the
+  //   first call to face()
+  // - face() is called once per face record, with the vertex indices
+  //   of the face, converted to int64_t
+  // - the records of the other elements are skipped
+  // - returns false if the file cannot be read, if it is an ASCII
+  //   file, or if it has no face:vertex_indices list property
+  static bool loadFaces(const char* filename, int64_t& nVertices,
+                        const std::function<void(std::span<const int64_t>)>& face);
+
+  // stream the records of an ASCII or binary PLY file, in batches of
+  // at most batchSize records, in constant memory
+  // - for each element of the file with an entry in visitor, in file
+  //   order, visitor(element,iFirst,nRecords) is called once per batch
+  //   with the records iFirst,...,iFirst+nRecords-1 of the element
+  // - the properties of element hold the values of the batch only,
+  //   with the default wrlMode conversions of Ply, and are accessed
+  //   as typed spans, e.g. element.getProperty("coord")->as<float>()
+  // - the records of the other elements are skipped
+  // - returns false if the file cannot be read; the exceptions thrown
+  //   by a visitor are propagated to the caller
+  using RecordVisitor =
+    std::function<void(Ply::Element& element, int64_t iFirst, int nRecords)>;
+  static bool loadRecords(const char* filename,
+                          const std::map<std::string,RecordVisitor>& visitor,
+                          int batchSize=(1<<16));
+
 private:
 
   static Ply::DataType systemEndian();
   static bool sameAsSystemEndian(Ply::DataType fileEndian);
 
-  static void addBinaryValue(Endian::SingleValueBuffer& buff, Ply::Element::Property::Type propertyType, bool swapBytes, void* value);
-  
-  static void addAsciiValue(const string& token, Ply::Element::Property::Type propertyType, void* value);
-  
-  static size_t readHeader(FILE* fp, Ply& ply, std::string indent="");
-  static size_t readBinaryData(FILE* fp, Ply& ply, std::string indent="");
-  static size_t readAsciiData(FILE* fp, Ply& ply, std::string indent="");
+  // - if layout is not null, the file layout of the elements is
+  //   returned in it
+  // - both versions return the size of the header in bytes
+  static size_t readHeader(FILE* fp, Ply& ply, std::string indent="",
+                           std::vector<FileElement>* layout=nullptr);
+  static size_t readHeader(const char* data, size_t size, Ply& ply, std::string indent="",
+                           std::vector<FileElement>* layout=nullptr);
+  static void   parseHeader(Tokenizer& ftkn, Ply& ply, std::string indent,
+                            std::vector<FileElement>* layout);
+
+  // both versions return the number of bytes decoded
+  static size_t readBinaryData(FILE* fp, Ply& ply,
+                               const std::vector<FileElement>& layout,
+                               std::string indent="");
+  static size_t readBinaryData(const char* data, size_t size, Ply& ply,
+                               const std::vector<FileElement>& layout,
+                               std::string indent="");
+  static size_t readAsciiData(FILE* fp, Ply& ply,
+                              const std::vector<FileElement>& layout,
+                              std::string indent="");
+  static size_t readAsciiData(const char* data, size_t size, Ply& ply,
+                              const std::vector<FileElement>& layout,
+                              std::string indent="");
 
 };
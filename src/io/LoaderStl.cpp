@@ -51,12 +51,26 @@
 #include "wrl/Appearance.hpp"
 #include "wrl/Material.hpp"
 #include "wrl/IndexedFaceSet.hpp"
+#include "wrl/SceneGraphProcessor.hpp"
 
 // reference
 // https://en.wikipedia.org/wiki/STL_(file_format)
 
 const char *LoaderStl::_ext = "stl";
 
+LoaderStl::LoaderStl():
+  _weldVertices(false),
+  _weldEpsilon(0.0f) {
+}
+
+void LoaderStl::setWeldVertices(const bool value) {
+  _weldVertices = value;
+}
+
+void LoaderStl::setWeldEpsilon(const float epsilon) {
+  _weldEpsilon = (epsilon>0.0f)?epsilon:0.0f;
+}
+
 IndexedFaceSet *LoaderStl::initializeSceneGraph(const char *filename, SceneGraph &wrl)
 {
   // 0) clear the container
@@ -198,6 +212,9 @@ bool LoaderStl::load(const char* filename, SceneGraph& sceneGraph)
         coordIndex.push_back(-1);
       }
 
+      if (_weldVertices)
+        SceneGraphProcessor::weldVertices(*ifs, _weldEpsilon);
+
       success = true;
 
       fclose(fp);
@@ -250,6 +267,9 @@ bool LoaderStl::load(const char* filename, SceneGraph& sceneGraph)
         coordIndex.push_back(-1);
       }
 
+      if (_weldVertices)
+        SceneGraphProcessor::weldVertices(*ifs, _weldEpsilon);
+
       success = true;
 
       // close the file (this statement may not be reached)
@@ -52,13 +52,29 @@ private:
 
 public:
 
-  LoaderStl()  = default;
+  LoaderStl();
   ~LoaderStl() = default;
 
   bool load(const char* filename, SceneGraph& sceneGraph) override;
   const char* ext() const override { return _ext; }
 
+  // STL files store every triangle with its own three vertices
+  // - if enabled, coincident vertices are merged after loading with
+  //   SceneGraphProcessor::weldVertices(ifs,epsilon); per-face normals
+  //   are preserved
+  // - epsilon==0 welds bitwise identical coordinates only
+  // - the options are set per instance, so that loaders used in the
+  //   same process do not interfere
+  void setWeldVertices(bool value);
+  void setWeldEpsilon(float epsilon);
+
 private:
+
+  /// default : false
+  bool  _weldVertices;
+  /// default : 0
+  float _weldEpsilon;
+
   IndexedFaceSet* initializeSceneGraph(const char* filename, SceneGraph& wrl);
   bool loadFacetAscii(TokenizerFile& tkn, Vec3f& n, Vec3f& v1, Vec3f& v2, Vec3f& v3);
   bool loadFacetBinary(FILE* fp, Vec3f& n, Vec3f& v1, Vec3f& v2, Vec3f& v3, uint16_t* abc);
@@ -0,0 +1,181 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin / 3D Shape Tech LLC
+//  Time-stamp: <2025-08-05 16:36:16 taubin>
+//------------------------------------------------------------------------
+//
+// MappedPly.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "MappedPly.hpp"
+
+MappedPly::MappedPly():
+  _file(),
+  _nBytesHeader(0),
+  _layout(),
+  _elementOffset() {
+}
+
+bool MappedPly::open(const char* filename) {
+  close();
+  if(_file.open(filename)==false)
+    return false;
+  try {
+    Ply ply;
+    _nBytesHeader = LoaderPly::readHeader(_file.getData(),_file.getSize(),ply,"",&_layout);
+    if(ply.getDataType()!=LoaderPly::systemEndian())
+      throw std::runtime_error("not a binary file with the system endianness");
+  } catch(const std::exception& /* e */) {
+    close();
+    return false;
+  }
+  _elementOffset.assign(1,0);
+  return true;
+}
+
+void MappedPly::close() {
+  _file.close();
+  _nBytesHeader = 0;
+  _layout.clear();
+  _elementOffset.clear();
+}
+
+int MappedPly::getElementIndex(const std::string& element) const {
+  for(size_t i=0;i<_layout.size();i++)
+    if(_layout[i].name==element)
+      return static_cast<int>(i);
+  return -1;
+}
+
+int MappedPly::getPropertyIndex(const int iElement, const std::string& property) const {
+  if(iElement<0 || iElement>=static_cast<int>(_layout.size()))
+    return -1;
+  const LoaderPly::FileElement& fileElement = _layout[static_cast<size_t>(iElement)];
+  for(size_t j=0;j<fileElement.property.size();j++)
+    if(fileElement.property[j].name==property)
+      return static_cast<int>(j);
+  return -1;
+}
+
+int64_t MappedPly::getNumberOfRecords(const std::string& element) const {
+  const int iElement = getElementIndex(element);
+  return (iElement<0)?0:_layout[static_cast<size_t>(iElement)].nRecords;
+}
+
+int64_t MappedPly::_getElementOffset(const int iElement) {
+  const char*   data = _file.getData()+_nBytesHeader;
+  const int64_t size = static_cast<int64_t>(_file.getSize()-_nBytesHeader);
+
+  while(static_cast<int>(_elementOffset.size())<=iElement) {
+    const LoaderPly::FileElement& fileElement = _layout[_elementOffset.size()-1];
+    int64_t offset = _elementOffset.back();
+
+    bool    hasList      = false;
+    int64_t nBytesRecord = 0;
+    for(const LoaderPly::FileProperty& fileProperty : fileElement.property) {
+      hasList      |= fileProperty.list;
+      nBytesRecord += Ply::Element::Property::getTypeSize(fileProperty.type);
+    }
+
+    if(hasList==false) {
+      offset += nBytesRecord*fileElement.nRecords;
+    } else {
+      for(int iRecord=0;iRecord<fileElement.nRecords;iRecord++) {
+        for(const LoaderPly::FileProperty& fileProperty : fileElement.property) {
+          const int64_t nBytesValue = Ply::Element::Property::getTypeSize(fileProperty.type);
+          if(fileProperty.list==false) {
+            offset += nBytesValue;
+            continue;
+          }
+          const int64_t nBytesCount = Ply::Element::Property::getTypeSize(fileProperty.listType);
+          if(offset+nBytesCount>size)
+            throw std::runtime_error("unexpected end of file");
+          // the fixed width types match the PLY type sizes on every
+          // platform, and the file is in the native byte order
+          int64_t nList = 0;
+          switch(fileProperty.listType) {
+          case Ply::Element::Property::CHAR:
+          case Ply::Element::Property::INT8:
+            { int8_t   n; std::memcpy(&n,data+offset,sizeof(n)); nList = n; } break;
+          case Ply::Element::Property::UCHAR:
+          case Ply::Element::Property::UINT8:
+            { uint8_t  n; std::memcpy(&n,data+offset,sizeof(n)); nList = n; } break;
+          case Ply::Element::Property::SHORT:
+          case Ply::Element::Property::INT16:
+            { int16_t  n; std::memcpy(&n,data+offset,sizeof(n)); nList = n; } break;
+          case Ply::Element::Property::USHORT:
+          case Ply::Element::Property::UINT16:
+            { uint16_t n; std::memcpy(&n,data+offset,sizeof(n)); nList = n; } break;
+          case Ply::Element::Property::INT:
+          case Ply::Element::Property::INT32:
+            { int32_t  n; std::memcpy(&n,data+offset,sizeof(n)); nList = n; } break;
+          case Ply::Element::Property::UINT:
+          case Ply::Element::Property::UINT32:
+            { uint32_t n; std::memcpy(&n,data+offset,sizeof(n)); nList = n; } break;
+          default:
+            throw std::runtime_error("unexpected list type");
+          }
+          if(nList<0)
+            throw std::runtime_error("negative list size");
+          offset += nBytesCount+nList*nBytesValue;
+        }
+      }
+    }
+
+    if(offset>size)
+      throw std::runtime_error("unexpected end of file");
+    _elementOffset.push_back(offset);
+  }
+
+  return _elementOffset[static_cast<size_t>(iElement)];
+}
+
+bool MappedPly::load(Ply& ply, const std::string& indent) {
+  bool success = false;
+  ply.clear();
+  if(isOpen()) {
+    try {
+      std::vector<LoaderPly::FileElement> layout;
+      const size_t nBytesHeader =
+        LoaderPly::readHeader(_file.getData(),_file.getSize(),ply,indent,&layout);
+      LoaderPly::readBinaryData(_file.getData()+nBytesHeader,_file.getSize()-nBytesHeader,
+                                ply,layout,indent);
+      success = true;
+    } catch(const std::exception& /* e */) {
+      ply.clear();
+    }
+  }
+  return success;
+}
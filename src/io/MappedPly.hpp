@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin / 3D Shape Tech LLC
+//  Time-stamp: <2025-08-05 16:36:08 taubin>
+//------------------------------------------------------------------------
+//
+// MappedPly.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <util/MappedFile.hpp>
+#include <wrl/Ply.hpp>
+#include "LoaderPly.hpp"
+
+class MappedPly {
+
+  // read-only, zero-copy access to a binary PLY file with the same
+  // endianness as the system
+  // - open() maps the file and parses the header from the mapping;
+  //   the data is not read, and the operating system loads the pages
+  //   of the file only when they are accessed
+  // - the scalar properties of elements without list properties, such
+  //   as the vertex coordinates, are exposed as strided views into
+  //   the mapping
+  // - load() decodes all the records into a Ply, as LoaderPly::load()
+  //   does, for the consumers which need contiguous arrays, such as
+  //   IndexedFaceSetPly
+
+public:
+
+  template<class T>
+  class View {
+
+  public:
+
+    View(): _data(nullptr), _stride(0), _size(0) { }
+    View(const char* data, const size_t stride, const size_t size):
+      _data(data), _stride(stride), _size(size) { }
+
+    size_t size()      const { return _size; }
+    size_t getStride() const { return _stride; }
+
+    // the records are not aligned in the file, and the values are
+    // copied out of the mapping one at a time
+    T operator[](const size_t i) const {
+      T value;
+      std::memcpy(&value,_data+i*_stride,sizeof(T));
+      return value;
+    }
+
+  private:
+
+    const char* _data;
+    size_t      _stride;
+    size_t      _size;
+
+  };
+
+  MappedPly();
+
+  // returns false if the file cannot be mapped, if the header cannot
+  // be parsed, or if it is not a binary file with the same endianness
+  // as the system
+  bool open(const char* filename);
+  void close();
+  bool isOpen() const { return _file.isOpen(); }
+
+  const std::vector<LoaderPly::FileElement>& getLayout() const { return _layout; }
+
+  // return -1 if not found
+  int     getElementIndex(const std::string& element) const;
+  int     getPropertyIndex(int iElement, const std::string& property) const;
+
+  // return 0 if not found
+  int64_t getNumberOfRecords(const std::string& element) const;
+
+  // - view of a scalar property of an element without list properties
+  // - T must be the type of the property in the file, e.g. float for
+  //   float or float32 properties
+  // - throws std::runtime_error if the property does not exist, if
+  //   the element has list properties, if T does not match, or if the
+  //   file is too short
+  template<class T>
+  View<T> getView(const std::string& element, const std::string& property);
+
+  // decode all the records into ply; returns false on error
+  bool load(Ply& ply, const std::string& indent="");
+
+private:
+
+  template<class T>
+  static bool isType(Ply::Element::Property::Type type);
+
+  // offset of the first record of the element from the start of the
+  // data; the sizes of the elements with list properties are found by
+  // scanning their records, only the first time they are needed
+  int64_t _getElementOffset(int iElement);
+
+  MappedFile                          _file;
+  size_t                              _nBytesHeader;
+  std::vector<LoaderPly::FileElement> _layout;
+  std::vector<int64_t>                _elementOffset;
+
+};
+
+template<class T>
+bool MappedPly::isType(const Ply::Element::Property::Type type) {
+  using Type = Ply::Element::Property::Type;
+  if constexpr (std::is_same_v<T,char> || std::is_same_v<T,signed char>)
+    return type==Type::CHAR   || type==Type::INT8;
+  else if constexpr (std::is_same_v<T,unsigned char>)
+    return type==Type::UCHAR  || type==Type::UINT8;
+  else if constexpr (std::is_same_v<T,short>)
+    return type==Type::SHORT  || type==Type::INT16;
+  else if constexpr (std::is_same_v<T,unsigned short>)
+    return type==Type::USHORT || type==Type::UINT16;
+  else if constexpr (std::is_same_v<T,int>)
+    return type==Type::INT    || type==Type::INT32;
+  else if constexpr (std::is_same_v<T,unsigned int>)
+    return type==Type::UINT   || type==Type::UINT32;
+  else if constexpr (std::is_same_v<T,float>)
+    return type==Type::FLOAT  || type==Type::FLOAT32;
+  else if constexpr (std::is_same_v<T,double>)
+    return type==Type::DOUBLE || type==Type::FLOAT64;
+  else
+    return false;
+}
+
+template<class T>
+MappedPly::View<T> MappedPly::getView(const std::string& element, const std::string& property) {
+  const int iElement  = getElementIndex(element);
+  const int iProperty = (iElement<0)?-1:getPropertyIndex(iElement,property);
+  if(iProperty<0)
+    throw std::runtime_error("no property "+element+":"+property);
+
+  const LoaderPly::FileElement& fileElement = _layout[static_cast<size_t>(iElement)];
+  size_t stride = 0;
+  size_t offset = 0;
+  for(size_t j=0;j<fileElement.property.size();j++) {
+    const LoaderPly::FileProperty& fileProperty = fileElement.property[j];
+    if(fileProperty.list)
+      throw std::runtime_error("element "+element+" has list properties");
+    if(j==static_cast<size_t>(iProperty))
+      offset = stride;
+    stride += static_cast<size_t>(Ply::Element::Property::getTypeSize(fileProperty.type));
+  }
+  if(!isType<T>(fileElement.property[static_cast<size_t>(iProperty)].type))
+    throw std::runtime_error("wrong type for property "+element+":"+property);
+
+  const size_t nRecords = static_cast<size_t>(fileElement.nRecords);
+  const size_t first    = _nBytesHeader+static_cast<size_t>(_getElementOffset(iElement));
+  if(first+stride*nRecords>_file.getSize())
+    throw std::runtime_error("unexpected end of file");
+
+  return View<T>(_file.getData()+first+offset,stride,nRecords);
+}
@@ -41,7 +41,12 @@
 
 #include "SaverPly.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 
 #include "wrl/Shape.hpp"
 #include "wrl/Appearance.hpp"
@@ -57,6 +62,229 @@ bool SaverPly::_skipAlpha = true;
 std::ostream* SaverPly::_ostrm = nullptr;
 std::string SaverPly::_indent = "";
 
+namespace {
+
+  // assembles binary data in a 1MB buffer, which is written with one
+  // fwrite() call when it is full, and by flush()
+  class BlockWriter {
+
+  public:
+
+    explicit BlockWriter(FILE* fp):
+      _fp(fp),
+      _buffer(size_t(1)<<20),
+      _end(0) {
+    }
+
+    // returns a pointer to the next n bytes of the output, which must
+    // be filled before the next call to write() or flush()
+    char* write(const size_t n) {
+      if(_buffer.size()-_end<n) {
+        flush();
+        if(_buffer.size()<n)
+          _buffer.resize(n);
+      }
+      char* p = _buffer.data()+_end;
+      _end += n;
+      return p;
+    }
+
+    void flush() {
+      if(_end>0 && fwrite(_buffer.data(),1,_end,_fp)!=_end)
+        throw std::runtime_error("unable to write binary data");
+      _end = 0;
+    }
+
+  private:
+
+    FILE*             _fp;
+    std::vector<char> _buffer;
+    size_t            _end;
+  };
+
+  template<class S>
+  inline void storeValue(char* p, const S v, const bool swapBytes) {
+    if(swapBytes) {
+      char b[sizeof(S)];
+      std::memcpy(b,&v,sizeof(S));
+      for(size_t i=0;i<sizeof(S);i++)
+        p[i] = b[sizeof(S)-1-i];
+    } else {
+      std::memcpy(p,&v,sizeof(S));
+    }
+  }
+
+  // encode n records, stride bytes apart, of a column with dim
+  // consecutive values per record
+  template<class S>
+  void gatherColumn(char* dst, const size_t stride, const S* src,
+                    const size_t dim, const size_t n, const bool swapBytes) {
+    for(size_t i=0;i<n;i++)
+      for(size_t j=0;j<dim;j++)
+        storeValue<S>(dst+i*stride+j*sizeof(S),src[i*dim+j],swapBytes);
+  }
+
+  // colors are stored as float in [0,1], and written as 3 uchar; M is
+  // the type of the product by 255
+  template<class M>
+  void gatherColor(char* dst, const size_t stride, const float* src, const size_t n) {
+    for(size_t i=0;i<n;i++)
+      for(size_t j=0;j<3;j++)
+        dst[i*stride+j] = static_cast<char>(static_cast<uchar>(M(255)*src[3*i+j]));
+  }
+
+  // stores a list size, which must fit in the list size type S;
+  // otherwise the file would be silently corrupted
+  template<class S>
+  inline void storeListSize(char* p, const int64_t value, const bool swapBytes) {
+    if(value<0 || value>static_cast<int64_t>(std::numeric_limits<S>::max()))
+      throw std::runtime_error("list of "+std::to_string(value)+
+                               " values does not fit its list size type");
+    storeValue<S>(p,static_cast<S>(value),swapBytes);
+  }
+
+  void storeInteger(char* p, const Ply::Element::Property::Type type,
+                    const int64_t value, const bool swapBytes) {
+    switch(type) {
+    case Ply::Element::Property::Type::CHAR:
+    case Ply::Element::Property::Type::INT8:
+      storeListSize<char>(p,value,swapBytes); break;
+    case Ply::Element::Property::Type::UCHAR:
+    case Ply::Element::Property::Type::UINT8:
+      storeListSize<uchar>(p,value,swapBytes); break;
+    case Ply::Element::Property::Type::SHORT:
+    case Ply::Element::Property::Type::INT16:
+      storeListSize<short>(p,value,swapBytes); break;
+    case Ply::Element::Property::Type::USHORT:
+    case Ply::Element::Property::Type::UINT16:
+      storeListSize<ushort>(p,value,swapBytes); break;
+    case Ply::Element::Property::Type::INT:
+    case Ply::Element::Property::Type::INT32:
+      storeListSize<int>(p,value,swapBytes); break;
+    case Ply::Element::Property::Type::UINT:
+    case Ply::Element::Property::Type::UINT32:
+      storeListSize<uint>(p,value,swapBytes); break;
+    default:
+      throw std::runtime_error("list size type must be an integer type");
+    }
+  }
+
+  // encoder of one property of a Ply element
+  // - the wrlMode coord and normal properties are written as 3 float
+  //   values per record, and color as 3 uchar values
+  // - the wrlMode coordIndex property has no list offsets; its faces
+  //   are delimited by -1 separators, which are not written
+  struct Column {
+    Ply::Element::Property*      property;
+    Ply::Element::Property::Type listType;  // NONE if not a list
+    size_t                       dim;       // values per record
+    size_t                       size;      // bytes per record, if not a list
+    size_t                       offset;    // in fixed size records
+    bool                         color;
+    bool                         coordIndex;
+
+    bool isList() const { return listType!=Ply::Element::Property::Type::NONE; }
+  };
+
+  Column makeColumn(Ply::Element::Property& property) {
+    const Ply::Element::Property::Type type = property.getPropertyType();
+    Column c;
+    c.property   = &property;
+    c.listType   = Ply::Element::Property::Type::NONE;
+    c.dim        = (type==Ply::Element::Property::Type::FLOAT32_3)?3:
+                   (type==Ply::Element::Property::Type::FLOAT32_2)?2:1;
+    c.color      = (property.isList()==false && property.getName()=="color");
+    c.coordIndex = (property.isList() && property.getName()=="coordIndex");
+    c.size       = (c.color)?3:static_cast<size_t>(Ply::Element::Property::getTypeSize(type));
+    c.offset     = 0;
+    if(property.isList())
+      c.listType = (c.coordIndex)?Ply::Element::Property::Type::UCHAR:property.getListType();
+    return c;
+  }
+
+  // encode the values of n records of a scalar column, starting with
+  // record iRecord
+  void encodeScalars(char* dst, const size_t stride, const Column& c,
+                     const size_t iRecord, const size_t n, const bool swapBytes) {
+    Ply::Element::Property& p = *c.property;
+    const size_t i0 = iRecord*c.dim;
+    if(c.color) {
+      gatherColor<double>(dst,stride,p.as<float>().data()+i0,n);
+      return;
+    }
+    switch(p.getPropertyType()) {
+    case Ply::Element::Property::Type::CHAR:
+    case Ply::Element::Property::Type::INT8:
+      gatherColumn(dst,stride,p.as<char>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::UCHAR:
+    case Ply::Element::Property::Type::UINT8:
+      gatherColumn(dst,stride,p.as<uchar>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::SHORT:
+    case Ply::Element::Property::Type::INT16:
+      gatherColumn(dst,stride,p.as<short>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::USHORT:
+    case Ply::Element::Property::Type::UINT16:
+      gatherColumn(dst,stride,p.as<ushort>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::INT:
+    case Ply::Element::Property::Type::INT32:
+      gatherColumn(dst,stride,p.as<int>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::UINT:
+    case Ply::Element::Property::Type::UINT32:
+      gatherColumn(dst,stride,p.as<uint>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::FLOAT:
+    case Ply::Element::Property::Type::FLOAT32:
+    case Ply::Element::Property::Type::FLOAT32_2:
+    case Ply::Element::Property::Type::FLOAT32_3:
+      gatherColumn(dst,stride,p.as<float>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::DOUBLE:
+    case Ply::Element::Property::Type::FLOAT64:
+      gatherColumn(dst,stride,p.as<double>().data()+i0,c.dim,n,swapBytes); break;
+    case Ply::Element::Property::Type::NONE:
+      throw std::runtime_error("unexpected NONE property type");
+    }
+  }
+
+  // write one list, with the values i0,...,i0+n-1 of the column
+  void encodeList(BlockWriter& writer, const Column& c,
+                  const size_t i0, const size_t n, const bool swapBytes) {
+    Ply::Element::Property& p = *c.property;
+    const size_t sizeCount = static_cast<size_t>(Ply::Element::Property::getTypeSize(c.listType));
+    const size_t sizeValue = static_cast<size_t>(p.getPropertyTypeSize());
+    char* dst = writer.write(sizeCount+n*sizeValue);
+    storeInteger(dst,c.listType,static_cast<int64_t>(n),swapBytes);
+    dst += sizeCount;
+    switch(p.getPropertyType()) {
+    case Ply::Element::Property::Type::CHAR:
+    case Ply::Element::Property::Type::INT8:
+      gatherColumn(dst,sizeValue,p.as<char>().data()+i0,1,n,swapBytes); break;
+    case Ply::Element::Property::Type::UCHAR:
+    case Ply::Element::Property::Type::UINT8:
+      gatherColumn(dst,sizeValue,p.as<uchar>().data()+i0,1,n,swapBytes); break;
+    case Ply::Element::Property::Type::SHORT:
+    case Ply::Element::Property::Type::INT16:
+      gatherColumn(dst,sizeValue,p.as<short>().data()+i0,1,n,swapBytes); break;
+    case Ply::Element::Property::Type::USHORT:
+    case Ply::Element::Property::Type::UINT16:
+      gatherColumn(dst,sizeValue,p.as<ushort>().data()+i0,1,n,swapBytes); break;
+    case Ply::Element::Property::Type::INT:
+    case Ply::Element::Property::Type::INT32:
+      gatherColumn(dst,sizeValue,p.as<int>().data()+i0,1,n,swapBytes); break;
+    case Ply::Element::Property::Type::UINT:
+    case Ply::Element::Property::Type::UINT32:
+      gatherColumn(dst,sizeValue,p.as<uint>().data()+i0,1,n,swapBytes); break;
+    case Ply::Element::Property::Type::FLOAT:
+    case Ply::Element::Property::Type::FLOAT32:
+      gatherColumn(dst,sizeValue,p.as<float>().data()+i0,1,n,swapBytes); break;
+    case Ply::Element::Property::Type::DOUBLE:
+    case Ply::Element::Property::Type::FLOAT64:
+      gatherColumn(dst,sizeValue,p.as<double>().data()+i0,1,n,swapBytes); break;
+    default:
+      throw std::runtime_error("unexpected list value type");
+    }
+  }
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////
 SaverPly::SaverPly():_dataType(_defaultDataType) {
 }
@@ -111,209 +339,54 @@ bool SaverPly::sameAsSystemEndian(Ply::DataType fileEndian) {
   return (fileEndian==systemEndian());
 }
 
-//////////////////////////////////////////////////////////////////////
-// static
-bool SaverPly::writeBinaryValue(FILE * fp, const Ply::Element::Property::Type listType, const bool swapBytes, int nList) {
-  bool success = false;
-  if(fp!=nullptr) {
-    Endian::SingleValueBuffer svb;
-    switch(listType) {
-    case Ply::Element::Property::Type::CHAR:
-    case Ply::Element::Property::Type::INT8:
-      svb.c[0] = static_cast<char>(nList);
-      success = (fwrite(&(svb.c[0]),1,1,fp)==1);
-      break;
-    case Ply::Element::Property::Type::UCHAR:
-    case Ply::Element::Property::Type::UINT8:
-      svb.uc[0] = static_cast<uchar>(nList);
-      success = (fwrite(&(svb.uc[0]),1,1,fp)==1);
-      break;
-    case Ply::Element::Property::Type::SHORT:
-    case Ply::Element::Property::Type::INT16:
-      svb.s[0] = static_cast<short>(nList);
-      if(swapBytes) Endian::swapShort(svb);
-      success = (fwrite(&(svb.s[0]),1,2,fp)==2);
-      break;
-    case Ply::Element::Property::Type::USHORT:
-    case Ply::Element::Property::Type::UINT16:
-      svb.us[0] = static_cast<ushort>(nList);
-      if(swapBytes) Endian::swapUShort(svb);
-      success = (fwrite(&(svb.us[0]),1,2,fp)==2);
-      break;
-    case Ply::Element::Property::Type::INT:
-    case Ply::Element::Property::Type::INT32:
-      svb.i[0] = static_cast<int>(nList);
-      if(swapBytes) Endian::swapInt(svb);
-      success = (fwrite(&(svb.i[0]),1,4,fp)==4);
-      break;
-    case Ply::Element::Property::Type::UINT:
-    case Ply::Element::Property::Type::UINT32:
-      svb.ui[0] = static_cast<uint>(nList);
-      if(swapBytes) Endian::swapUInt(svb);
-      success = (fwrite(&(svb.ui[0]),1,4,fp)==4);
-      break;
-    default:
-      break;
-    }
-  }
-  return success;
-}
-
-//////////////////////////////////////////////////////////////////////
-// static
-bool SaverPly::writeBinaryValue(FILE * fp,
-  const Ply::Element::Property::Type propertyType,
-  const bool swapBytes,
-  void* value,
-  int index) {
-
-  bool success = false;
-  if(fp!=nullptr) {
-    Endian::SingleValueBuffer svb;
-    switch(propertyType) {
-    case Ply::Element::Property::Type::CHAR:
-    case Ply::Element::Property::Type::INT8:
-      {
-        svb.c[0] = (*static_cast<std::vector<char>*>(value))[UL(index)];
-        success = (fwrite(&(svb.c[0]),1,1,fp)==2);
-      }
-      break;
-    case Ply::Element::Property::Type::UCHAR:
-    case Ply::Element::Property::Type::UINT8:
-      {
-        svb.uc[0] = (*static_cast<std::vector<uchar>*>(value))[UL(index)];
-        success = (fwrite(&(svb.uc[0]),1,1,fp)==2);
-      }
-      break;
-    case Ply::Element::Property::Type::SHORT:
-    case Ply::Element::Property::Type::INT16:
-      {
-        svb.s[0] = (*static_cast<std::vector<short>*>(value))[UL(index)];
-        if(swapBytes) Endian::swapShort(svb);
-        success = (fwrite(&(svb.s[0]),1,2,fp)==2);
-      }
-      break;
-    case Ply::Element::Property::Type::USHORT:
-    case Ply::Element::Property::Type::UINT16:
-      {
-        svb.us[0] = (*static_cast<std::vector<ushort>*>(value))[UL(index)];
-        if(swapBytes) Endian::swapUShort(svb);
-        success = (fwrite(&(svb.us[0]),1,2,fp)==2);
-      }
-      break;
-    case Ply::Element::Property::Type::INT:
-    case Ply::Element::Property::Type::INT32:
-      {
-        svb.i[0] = (*static_cast<std::vector<int>*>(value))[UL(index)];
-        if(swapBytes) Endian::swapInt(svb);
-        success = (fwrite(&(svb.i[0]),1,4,fp)==4);
-      }
-      break;
-    case Ply::Element::Property::Type::UINT:
-    case Ply::Element::Property::Type::UINT32:
-      {
-        svb.ui[0] = (*static_cast<std::vector<uint>*>(value))[UL(index)];
-        if(swapBytes) Endian::swapUInt(svb);
-        success = (fwrite(&(svb.ui[0]),1,4,fp)==4);
-      }
-      break;
-    case Ply::Element::Property::Type::FLOAT:
-    case Ply::Element::Property::Type::FLOAT32:
-    case Ply::Element::Property::Type::FLOAT32_2:
-    case Ply::Element::Property::Type::FLOAT32_3:
-      {
-        int n =
-          (propertyType==Ply::Element::Property::Type::FLOAT32_3)?3:
-          (propertyType==Ply::Element::Property::Type::FLOAT32_2)?2:1;
-        for(int i=0;i<n;i++) {
-          svb.f[0] = (*static_cast<std::vector<float>*>(value))[n*UL(index)+i];
-          if(swapBytes) Endian::swapFloat(svb);
-          success = (fwrite(&(svb.f[0]),1,4,fp)==4);
-          if(success==false) break;
-        }
-      }
-      break;
-    case Ply::Element::Property::Type::DOUBLE:
-    case Ply::Element::Property::Type::FLOAT64:
-      {
-        svb.d[0] = (*static_cast<std::vector<double>*>(value))[UL(index)];
-        if(swapBytes) Endian::swapDouble(svb);
-        success = (fwrite(&(svb.d[0]),1,8,fp)==8);
-      }
-      break; 
-    default:
-      break;
-    }
-  }
-  return success;
-}
-
-//////////////////////////////////////////////////////////////////////
-// static
-  
-bool SaverPly::writeBinaryColorValue
-(FILE * fp, const bool swapBytes, void* value, int index) {
-  bool success = false;
-  if(fp!=nullptr) {
-    Endian::SingleValueBuffer svb;
-    for(int i=0;i<3;i++) {
-      float& f = (*static_cast<std::vector<float>*>(value))[3*UL(index)+i];
-      svb.uc[0] = static_cast<uchar>(255.0*f); 
-      success = (fwrite(&(svb.uc[0]),1,1,fp)==1);
-      if(success==false) break;
-    }
-  }
-  return success;
-}
-
 //////////////////////////////////////////////////////////////////////
 // static
 bool SaverPly::writeAsciiValue
 (FILE * fp, const Ply::Element::Property::Type propertyType,
- void* value, int index) {
+ Ply::Element::Property& property, int index) {
   bool success = false;
   if(fp!=nullptr) {
     switch(propertyType) {
     case Ply::Element::Property::Type::CHAR:
     case Ply::Element::Property::Type::INT8:
       {
-        char & c = (*static_cast<std::vector<char>*>(value))[UL(index)];
+        char & c = property.as<char>()[UL(index)];
         success = (fprintf(fp,"%d",c)>0);
       }
       break;
     case Ply::Element::Property::Type::UCHAR:
     case Ply::Element::Property::Type::UINT8:
       {
-        uchar & uc = (*static_cast<std::vector<uchar>*>(value))[UL(index)];
+        uchar & uc = property.as<uchar>()[UL(index)];
         success = (fprintf(fp,"%d",uc)>0);
       }
       break;
     case Ply::Element::Property::Type::SHORT:
     case Ply::Element::Property::Type::INT16:
       {
-        short & s = (*static_cast<std::vector<short>*>(value))[UL(index)];
+        short & s = property.as<short>()[UL(index)];
         success = (fprintf(fp,"%d",s)>0);
       }
       break;
     case Ply::Element::Property::Type::USHORT:
     case Ply::Element::Property::Type::UINT16:
       {
-        ushort & us = (*static_cast<std::vector<ushort>*>(value))[UL(index)];
+        ushort & us = property.as<ushort>()[UL(index)];
         success = (fprintf(fp,"%d",us)>0);
       }
       break;
     case Ply::Element::Property::Type::INT:
     case Ply::Element::Property::Type::INT32:
       {
-        int & i = (*static_cast<std::vector<int>*>(value))[UL(index)];
+        int & i = property.as<int>()[UL(index)];
         success = (fprintf(fp,"%d",i)>0);
       }
       break;
     case Ply::Element::Property::Type::UINT:
     case Ply::Element::Property::Type::UINT32:
       {
-        uint & ui = (*static_cast<std::vector<uint>*>(value))[UL(index)];
-        success = (fprintf(fp,"%d",ui)>0);
+        uint & ui = property.as<uint>()[UL(index)];
+        success = (fprintf(fp,"%u",ui)>0);
       }
       break;
     case Ply::Element::Property::Type::FLOAT:
@@ -325,7 +398,7 @@ bool SaverPly::writeAsciiValue
           (propertyType==Ply::Element::Property::Type::FLOAT32_3)?3:
           (propertyType==Ply::Element::Property::Type::FLOAT32_2)?2:1;
         for(int i=0;i<n;i++) {
-          float & f = (*static_cast<std::vector<float>*>(value))[i+n*UL(index)];
+          float & f = property.as<float>()[i+n*UL(index)];
           success = (fprintf(fp,"%f ",D(f))>0);
           if(success==false) break;
         }
@@ -334,7 +407,7 @@ bool SaverPly::writeAsciiValue
     case Ply::Element::Property::Type::DOUBLE:
     case Ply::Element::Property::Type::FLOAT64:
       {
-        double & d = (*static_cast<std::vector<double>*>(value))[UL(index)];
+        double & d = property.as<double>()[UL(index)];
         success = (fprintf(fp,"%f",d)>0);
       }
       break; 
@@ -348,11 +421,11 @@ bool SaverPly::writeAsciiValue
 //////////////////////////////////////////////////////////////////////
 // static
   
-bool SaverPly::writeAsciiColorValue(FILE * fp, void* value, int index) {
+bool SaverPly::writeAsciiColorValue(FILE * fp, Ply::Element::Property& property, int index) {
   bool success = false;
   if(fp!=nullptr) {
     for(int i=0;i<3;i++) {
-      float& f = (*static_cast<std::vector<float>*>(value))[3*UL(index)+i];
+      float& f = property.as<float>()[3*UL(index)+i];
       uchar uc = static_cast<uchar>(255.0*f); 
       success = (fprintf(fp,"%3d ",uc)>0);
       if(success==false) break;
@@ -518,6 +591,15 @@ bool SaverPly::writeHeader(FILE *fp, Ply& ply, const std::string indent, Ply::Da
             fprintf(fp,"property uchar green\n");
             fprintf(fp,"property uchar blue\n");
 
+          } else if(propertyName=="texCoord") {
+
+            if(_ostrm!=nullptr) {
+              *_ostrm << indent << "  property float u" << endl;
+              *_ostrm << indent << "  property float v" << endl;
+            }
+            fprintf(fp,"property float u\n");
+            fprintf(fp,"property float v\n");
+
           } else {
             if(_ostrm!=nullptr) {
               *_ostrm << indent << "  property "
@@ -573,12 +655,11 @@ bool SaverPly::writeBinaryData(FILE * fp, Ply& ply, const std::string indent, Pl
 
     Ply::Element* element;
     Ply::Element::Property* property;
-    Ply::Element::Property::Type listType;
-    Ply::Element::Property::Type propertyType;
-    void* propertyValue;
-    int iElement,iList0,iList1,iList,nList,k0,k1;
-    int iProperty,iRecord,nElements,nProperties,nRecords;
-    std::string name,propertyName;
+    int iElement,iProperty,nElements,nProperties,nRecords,k0,k1;
+    std::string name;
+
+    BlockWriter         writer(fp);
+    std::vector<Column> column;
 
     nElements = ply.getNumberOfElements();
     if(_ostrm!=nullptr) {
@@ -604,59 +685,71 @@ bool SaverPly::writeBinaryData(FILE * fp, Ply& ply, const std::string indent, Pl
         *_ostrm << indent << "        ";
       }
 
-      for(k0=iRecord=0;iRecord<nRecords;iRecord++) {
-
-        for(iProperty=0;iProperty<nProperties;iProperty++) {
-          property      = element->getProperty(iProperty);
-          propertyName  = property->getName();
-          if(_skipAlpha && propertyName=="alpha") continue;
-          propertyType  = property->getPropertyType();
-          propertyValue = property->getValue();
+      // compile the element encoder, with one column per property
+      bool   hasList = false;
+      size_t stride  = 0;
+      column.clear();
+      for(iProperty=0;iProperty<nProperties;iProperty++) {
+        property = element->getProperty(iProperty);
+        if(_skipAlpha && property->getName()=="alpha") continue;
+        Column c = makeColumn(*property);
+        c.offset = stride;
+        stride  += c.size;
+        hasList |= c.isList();
+        column.push_back(c);
+      }
 
-          if(property->isList()) {
-            listType = property->getListType();
-            iList0   = property->getListFirst(iRecord );
-            nList    = property->getListFirst(iRecord+1)-iList0;
-            if(propertyName=="coordIndex") nList--; // don't write -1 separator
-            iList1   = iList0+nList;
-            
-            if(writeBinaryValue(fp,listType,swapBytes,nList)==false)
-              throw std::runtime_error("unable to write list binary count");
-            for(iList=iList0;iList<iList1;iList++) {
-              if(writeBinaryValue
-                 (fp,propertyType,swapBytes,propertyValue,iList)==false)
-                throw std::runtime_error("unable to write list binary value");
-            }
-          } else {
-            if(propertyName=="color") {
-              if(writeBinaryColorValue(fp,swapBytes,propertyValue,iRecord)==false)
-                throw std::runtime_error("unable to write binary value");
+      // fixed size records are encoded in blocks of about 1MB, one
+      // column at a time; records with lists are encoded one at a time
+      const size_t n0     = static_cast<size_t>(std::max(nRecords,0));
+      const size_t nBlock =
+        (hasList)?1:std::max<size_t>((size_t(1)<<20)/std::max<size_t>(stride,1),1);
+      size_t iCoordIndex = 0; // next value of coordIndex
+      k0 = 0;
+      for(size_t iRecord=0;iRecord<n0;iRecord+=nBlock) {
+        const size_t n = std::min(nBlock,n0-iRecord);
+        if(hasList==false) {
+          char* block = writer.write(n*stride);
+          for(const Column& c : column)
+            encodeScalars(block+c.offset,stride,c,iRecord,n,swapBytes);
+        } else {
+          for(const Column& c : column) {
+            if(c.isList()==false) {
+              encodeScalars(writer.write(c.size),0,c,iRecord,1,swapBytes);
+            } else if(c.coordIndex) {
+              std::span<int> index = c.property->as<int>();
+              size_t i1 = iCoordIndex;
+              while(i1<index.size() && index[i1]>=0) i1++;
+              encodeList(writer,c,iCoordIndex,i1-iCoordIndex,swapBytes);
+              iCoordIndex = i1+1;
             } else {
-              if(writeBinaryValue
-                 (fp,propertyType,swapBytes,propertyValue,iRecord)==false)
-                throw std::runtime_error("unable to write binary value");
+              const int iList0 = c.property->getListFirst(static_cast<int>(iRecord));
+              const int iList1 = c.property->getListFirst(static_cast<int>(iRecord)+1);
+              if(iList0<0 || iList1<iList0)
+                throw std::runtime_error("missing list offsets");
+              encodeList(writer,c,static_cast<size_t>(iList0),
+                         static_cast<size_t>(iList1-iList0),swapBytes);
             }
           }
-          
-        } // for(iProperty ...
+        }
 
         // report progress
-        k1 = (10*(iRecord+1))/nRecords;
+        k1 = static_cast<int>((10*(iRecord+n))/n0);
         if(k1>k0) {
           if(_ostrm!=nullptr) {
             *_ostrm << (10*k1) << "% ";
           }
           k0 = k1;
         }
-          
-      } // for(iRecord ...
-      
+      }
+
       if(_ostrm!=nullptr) {
         *_ostrm << endl;
       }
-        
     }
-      
+
+    writer.flush();
+
     success = true;
       
   } catch (const std::exception& e) {
@@ -692,7 +785,6 @@ SaverPly::writeAsciiData(FILE * fp, Ply& ply, const std::string indent, Ply::Dat
     Ply::Element::Property* property;
     // Ply::Element::Property::Type listType;
     Ply::Element::Property::Type propertyType;
-    void* propertyValue;
     int iElement,iList0,iList1,iList,nList,iProperty;
     int iRecord,nElements,nProperties,nRecords,k0,k1;
     std::string name,propertyName;
@@ -721,6 +813,10 @@ SaverPly::writeAsciiData(FILE * fp, Ply& ply, const std::string indent, Ply::Dat
         *_ostrm << indent << "        ";
       }
 
+      // the wrlMode coordIndex has no list offsets; its faces are
+      // delimited by -1 separators, which are not written
+      int iCoordIndex = 0;
+
       for(k0=iRecord=0;iRecord<nRecords;iRecord++) {
 
         for(iProperty=0;iProperty<nProperties;iProperty++) {
@@ -728,28 +824,36 @@ SaverPly::writeAsciiData(FILE * fp, Ply& ply, const std::string indent, Ply::Dat
           propertyName  = property->getName();
           if(_skipAlpha && propertyName=="alpha") continue;
           propertyType  = property->getPropertyType();
-          propertyValue = property->getValue();
 
           if(property->isList()) {
             // listType = property->getListType();
-            iList0   = property->getListFirst(iRecord );
-            nList    = property->getListFirst(iRecord+1)-iList0;
-            if(propertyName=="coordIndex") nList--; // don't write -1 separator 
-            iList1   = iList0+nList;
+            if(propertyName=="coordIndex") {
+              std::span<const int> coordIndex = property->as<int>();
+              iList0 = iList1 = iCoordIndex;
+              while(iList1<I(coordIndex.size()) && coordIndex[UL(iList1)]>=0)
+                iList1++;
+              nList       = iList1-iList0;
+              iCoordIndex = iList1+1;
+            } else {
+              iList0   = property->getListFirst(iRecord );
+              nList    = property->getListFirst(iRecord+1)-iList0;
+              iList1   = iList0+nList;
+            }
 
             fprintf(fp,"%d ",nList);
             for(iList=iList0;iList<iList1;) {
-              if(writeAsciiValue(fp,propertyType,propertyValue,iList)==false)
+              if(writeAsciiValue(fp,propertyType,*property,iList)==false)
                 throw std::runtime_error("unable to write list ascii value");
               if(++iList<iList1) fprintf(fp," ");
             }
+            fprintf(fp," ");
 
           } else /* if(property->isList()==false) */ {
             if(propertyName=="color") {
-              if(writeAsciiColorValue(fp,propertyValue,iRecord)==false)
+              if(writeAsciiColorValue(fp,*property,iRecord)==false)
                 throw std::runtime_error("unable to write ascii color value");
             } else {
-              if(writeAsciiValue(fp,propertyType,propertyValue,iRecord)==false)
+              if(writeAsciiValue(fp,propertyType,*property,iRecord)==false)
                 throw std::runtime_error("unable to write ascii value");
             }
 
@@ -950,7 +1054,7 @@ bool SaverPly::writeHeader(FILE *fp, IndexedFaceSet& ifs, const std::string inde
       }
           
       // color -> UCHAR red,green,blue
-      if(ifs.hasColorPerVertex()) {
+      if(ifs.hasColorPerFace()) {
         fprintf(fp,"property uchar red\n");
         fprintf(fp,"property uchar green\n");
         fprintf(fp,"property uchar blue\n");            
@@ -1003,7 +1107,7 @@ bool SaverPly::writeBinaryData(FILE * fp, IndexedFaceSet& ifs, const std::string
 
   bool swapBytes = (sameAsSystemEndian(dataType)==false);
 
-  int i,i0,i1,iF,nList,iV,iN,iC,j,k0,k1;
+  int i0,i1,iF,iN,iC,k0,k1;
 
   std::vector<float>& coord         = ifs.getCoord();
   std::vector<int>&   coordIndex    = ifs.getCoordIndex();
@@ -1017,114 +1121,114 @@ bool SaverPly::writeBinaryData(FILE * fp, IndexedFaceSet& ifs, const std::string
   int nVertices = ifs.getNumberOfVertices();
   int nFaces    = ifs.getNumberOfFaces();
 
-  Endian::SingleValueBuffer svb;
-
-  if(_ostrm!=nullptr) {
-    *_ostrm << indent << "  name = vertex" << endl;
-    *_ostrm << indent << "    ";
-  }
+  try {
 
-  for(k0=iV=0;iV<nVertices;iV++) {
+    BlockWriter writer(fp);
 
-    if(true /* ifs.hasCoordPerVertex() */) {
-      for(j=0;j<3;j++) {
-        svb.f[0] = coord[UI(3*iV+j)];
-        if(swapBytes) Endian::swapFloat(svb);
-        fwrite(&(svb.f[0]),1,4,fp); // ==4
-      }
+    if(_ostrm!=nullptr) {
+      *_ostrm << indent << "  name = vertex" << endl;
+      *_ostrm << indent << "    ";
     }
-    if(ifs.hasNormalPerVertex()) {
-      for(j=0;j<3;j++) {
-        svb.f[0] = normal[UI(3*iV+j)];
-        if(swapBytes) Endian::swapFloat(svb);
-        fwrite(&(svb.f[0]),1,4,fp); // ==4
+
+    // the vertex records have a fixed size, and are encoded in blocks
+    // of about 1MB, one column at a time
+    const bool   hasNormal   = ifs.hasNormalPerVertex();
+    const bool   hasColor    = ifs.hasColorPerVertex();
+    const bool   hasTexCoord = ifs.hasTexCoordPerVertex();
+    const size_t stride      = 12+((hasNormal)?12:0)+((hasColor)?3:0)+((hasTexCoord)?8:0);
+    const size_t nV          = static_cast<size_t>(std::max(nVertices,0));
+    const size_t nBlock      = (size_t(1)<<20)/stride;
+    k0 = 0;
+    for(size_t iV=0;iV<nV;iV+=nBlock) {
+      const size_t n      = std::min(nBlock,nV-iV);
+      char*        block  = writer.write(n*stride);
+      size_t       offset = 0;
+      gatherColumn(block,stride,coord.data()+3*iV,3,n,swapBytes);
+      offset += 12;
+      if(hasNormal) {
+        gatherColumn(block+offset,stride,normal.data()+3*iV,3,n,swapBytes);
+        offset += 12;
       }
-    }
-    if(ifs.hasColorPerVertex()) {
-      for(j=0;j<3;j++) {
-        svb.uc[0] = UC(color[UI(3*iV+j)]*255.0f);
-        if(swapBytes) Endian::swapFloat(svb);
-        fwrite(&(svb.uc[0]),1,1,fp); // ==1
+      if(hasColor) {
+        gatherColor<float>(block+offset,stride,color.data()+3*iV,n);
+        offset += 3;
       }
-    }
-    if(ifs.hasTexCoordPerVertex()) {
-      for(j=0;j<2;j++) {
-        svb.f[0] = texCoord[UI(2*iV+j)];
-        if(swapBytes) Endian::swapFloat(svb);
-        fwrite(&(svb.f[0]),1,4,fp); // ==4
+      if(hasTexCoord) {
+        gatherColumn(block+offset,stride,texCoord.data()+2*iV,2,n,swapBytes);
       }
-    }
 
-    k1 = (10*(iV+1))/nVertices;
-    if(k1>k0) {
-      if(_ostrm!=nullptr) {
-        *_ostrm << (10*k1) << "% ";
+      k1 = static_cast<int>((10*(iV+n))/nV);
+      if(k1>k0) {
+        if(_ostrm!=nullptr) {
+          *_ostrm << (10*k1) << "% ";
+        }
+        k0 = k1;
       }
-      k0 = k1;
     }
-  }
-  if(_ostrm!=nullptr) {
-    *_ostrm << endl;
-  }
-
-  if(nFaces>0) {
     if(_ostrm!=nullptr) {
-      *_ostrm << indent << "  name = face" << endl;
-      *_ostrm << indent << "    ";
+      *_ostrm << endl;
     }
 
-    bool ifsHasNormalPerFace = ifs.hasNormalPerFace();
-    bool ifsHasColorPerFace  = ifs.hasColorPerFace();
+    if(nFaces>0) {
+      if(_ostrm!=nullptr) {
+        *_ostrm << indent << "  name = face" << endl;
+        *_ostrm << indent << "    ";
+      }
 
-    for(k0=iF=i0=i1=0;i1<I(coordIndex.size());i1++) {
+      bool ifsHasNormalPerFace = ifs.hasNormalPerFace();
+      bool ifsHasColorPerFace  = ifs.hasColorPerFace();
 
-      if(coordIndex[UI(i1)]<0) {
-        nList = i1-i0;
+      // each face record is encoded with one call to writer.write()
+      for(k0=iF=i0=i1=0;i1<I(coordIndex.size());i1++) {
 
-        svb.uc[0] = UC(nList);
-        fwrite(&(svb.uc[0]),1,1,fp); // ==1
+        if(coordIndex[UI(i1)]<0) {
+          const size_t nList = static_cast<size_t>(i1-i0);
+          char* p = writer.write(1+4*nList+
+                                 ((ifsHasNormalPerFace)?12:0)+
+                                 ((ifsHasColorPerFace)?3:0));
 
-        for(i=i0;i<i1;i++) {
-          svb.i[0] = coordIndex[UI(i)];
-          if(swapBytes) Endian::swapInt(svb);
-          fwrite(&(svb.i[0]),1,4,fp); // ==4
-        }
+          storeListSize<uchar>(p,static_cast<int64_t>(nList),swapBytes);
+          gatherColumn(p+1,4,coordIndex.data()+i0,1,nList,swapBytes);
+          p += 1+4*nList;
 
-        if(ifsHasNormalPerFace) {
-          iN = (normalIndex.size()>0)?normalIndex[UI(iF)]:iF;
-          for(j=0;j<3;j++) {
-            svb.f[0] = normal[UI(3*iN+j)];
-            if(swapBytes) Endian::swapFloat(svb);
-            fwrite(&(svb.f[0]),1,4,fp); // ==4
+          if(ifsHasNormalPerFace) {
+            iN = (normalIndex.size()>0)?normalIndex[UI(iF)]:iF;
+            gatherColumn(p,12,normal.data()+3*iN,3,1,swapBytes);
+            p += 12;
           }
-        }
 
-        if(ifsHasColorPerFace) {
-          iC = (colorIndex.size()>0)?colorIndex[UI(iF)]:iF;
-          for(j=0;j<3;j++) {
-            svb.uc[0] = UC(color[UI(3*iC+j)]*255.0f);
-            if(swapBytes) Endian::swapFloat(svb);
-            fwrite(&(svb.uc[0]),1,1,fp); // ==1
+          if(ifsHasColorPerFace) {
+            iC = (colorIndex.size()>0)?colorIndex[UI(iF)]:iF;
+            gatherColor<float>(p,3,color.data()+3*iC,1);
           }
-        }
 
-        k1 = (10*(iF+1))/nFaces;
-        if(k1>k0) {
-          if(_ostrm!=nullptr) {
-            *_ostrm << (10*k1) << "% ";
+          k1 = (10*(iF+1))/nFaces;
+          if(k1>k0) {
+            if(_ostrm!=nullptr) {
+              *_ostrm << (10*k1) << "% ";
+            }
+            k0 = k1;
           }
-          k0 = k1;
+
+          i0=i1+1; iF++;
         }
+      }
 
-        i0=i1+1; iF++;
+      if(_ostrm!=nullptr) {
+        *_ostrm << endl;
       }
-    }
 
+    } // if(nFaces>0)
+
+    writer.flush();
+
+  } catch(const std::exception& e) {
     if(_ostrm!=nullptr) {
-      *_ostrm << endl;
+      *_ostrm << indent << "  " << e.what() << endl;
+      *_ostrm << indent << "} SaverPly::writeBinaryData(IndexedFaceSet &)" << endl;
     }
-    
-  } // if(nFaces>0)
+    return false;
+  }
 
   if(_ostrm!=nullptr) {
     *_ostrm << indent << "} SaverPly::writeBinaryData(IndexedFaceSet &)" << endl;
@@ -1217,22 +1321,22 @@ bool SaverPly::writeAsciiData(FILE * fp, IndexedFaceSet& ifs, const std::string
 
     for(k0=iF=i0=i1=0;i1<I(coordIndex.size());i1++) {
       if(coordIndex[UI(i1)]<0) {
-        nList = UC(i1-i0);
+        nList = static_cast<uint>(i1-i0);
 
-        fprintf(fp,"%d ",nList);
+        fprintf(fp,"%u ",nList);
         for(i=i0;i<i1;i++)
           fprintf(fp,"%d ",coordIndex[UI(i)]);
         
         if(ifsHasNormalPerFace) {
           iN = (normalIndex.size()>0)?normalIndex[UI(iF)]:iF;
           for(j=0;j<3;j++)
-            fprintf(fp,"%f ",D(normal[UI(iN)]));
+            fprintf(fp,"%f ",D(normal[UI(3*iN+j)]));
         }
 
         if(ifsHasColorPerFace) {
           iC = (colorIndex.size()>0)?colorIndex[UI(iF)]:iF;
           for(j=0;j<3;j++)
-            fprintf(fp,"%f ",D(color[UC(iC)]));
+            fprintf(fp,"%d ",UC(color[UI(3*iC+j)]*255.0f));
         }
 
         fprintf(fp,"\n");
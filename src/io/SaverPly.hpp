@@ -76,15 +76,9 @@ private:
   static Ply::DataType systemEndian();
   static bool sameAsSystemEndian(Ply::DataType fileEndian);
 
-  static bool writeBinaryValue(FILE* fp, Ply::Element::Property::Type listType, bool swapBytes, int nList);
-
-  static bool writeBinaryValue(FILE* fp, Ply::Element::Property::Type propertyType, bool swapBytes, void* value, int i);
-  
-  static bool writeBinaryColorValue(FILE* fp, bool swapBytes, void* value, int i);
-
-  static bool writeAsciiValue(FILE* fp, Ply::Element::Property::Type propertyType, void* value, int i);
+  static bool writeAsciiValue(FILE* fp, Ply::Element::Property::Type propertyType, Ply::Element::Property& property, int i);
   
-  static bool writeAsciiColorValue(FILE* fp, void* value, int i);
+  static bool writeAsciiColorValue(FILE* fp, Ply::Element::Property& property, int i);
   
   static bool
   writeHeader(FILE * fp, Ply& ply, const string indent="",
@@ -63,7 +63,6 @@ bool SaverStl::saveAscii(FILE* fp, const char* solidname, IndexedFaceSet& ifs) c
 
   int nF = ifs.getNumberOfFaces();
   const std::vector<float>& coord = ifs.getCoord();
-  const std::vector<int>& coordIndex = ifs.getCoordIndex();
   const std::vector<float>& normal = ifs.getNormal();
   const std::vector<int>& normalIndex = ifs.getNormalIndex();
   Faces faces(ifs.getNumberOfCoord(),  ifs.getCoordIndex());
@@ -80,8 +79,7 @@ bool SaverStl::saveAscii(FILE* fp, const char* solidname, IndexedFaceSet& ifs) c
     ss << std::format("facet normal {:.6e} {:.6e} {:.6e}\n", normal[3*iN], normal[3*iN + 1], normal[3*iN + 2]);
 
     ss << "  outer loop\n";
-    for (int j = 0; j < 3; j++) {
-      const int iV = coordIndex[4 * iF + j];
+    for (const int iV : faces.getFaceVertices(iF)) {
       ss << std::format("    vertex {:.6e} {:.6e} {:.6e}\n", coord[3*iV], coord[3*iV+1], coord[3*iV+2]);
     }
     ss << "  endloop\n";
@@ -0,0 +1,1071 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2025-08-05 16:39:13 taubin>
+//------------------------------------------------------------------------
+//
+// dgpBench.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of the Brown University nor the
+//       names of its contributors may be used to endorse or promote products
+//       derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL GABRIEL TAUBIN BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <span>
+#include <string>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#include <core/EditableMesh.hpp>
+#include <core/Faces.hpp>
+#include <core/Graph.hpp>
+#include <core/HalfEdges.hpp>
+#include <core/IndexTraits.hpp>
+#include <core/Partition.hpp>
+#include <core/PolygonMesh.hpp>
+#include <util/Parallel.hpp>
+#include <wrl/SceneGraph.hpp>
+#include <wrl/SceneGraphProcessor.hpp>
+#include <wrl/Shape.hpp>
+#include <wrl/IndexedFaceSet.hpp>
+
+#include "dgpPrt.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+class Data {
+public:
+  bool   _debug;
+  bool   _shuffle;
+  int    _gridSize;
+  int    _repeat;
+  int    _threads;
+  string _mesh;
+  long   _corners;
+  string _outFile;
+public:
+  Data():
+    _debug(false),
+    _shuffle(false),
+    _gridSize(512),
+    _repeat(3),
+    _threads(2),
+    _mesh("grid"),
+    _corners(0),
+    _outFile("")
+  { }
+};
+
+void options(Data& D) {
+  cout << "   -d|-debug               [" << tv(D._debug)            << "]" << endl;
+  cout << "   -s|-shuffle             [" << tv(D._shuffle)          << "]" << endl;
+  cout << "   -n|-gridSize N          [" << D._gridSize              << "]" << endl;
+  cout << "   -r|-repeat R            [" << D._repeat                << "]" << endl;
+  cout << "   -t|-threads T           [" << D._threads               << "]" << endl;
+  cout << "   -m|-mesh M              [" << D._mesh                  << "]"
+       << " grid|icosphere|torus|fans|soup" << endl;
+  cout << "   -c|-corners C           [" << D._corners               << "]"
+       << " approximate size of the mesh; 0 uses gridSize" << endl;
+  cout << "   -o|-outFile F           [" << D._outFile               << "]"
+       << " topology timings as .csv or .json" << endl;
+}
+
+void usage(Data& D) {
+  cout << "USAGE: dgpBench [options]" << endl;
+  cout << "   -h|-help" << endl;
+  options(D);
+  cout << endl;
+  exit(0);
+}
+
+void error(const char *msg) {
+  cout << "ERROR: dgpBench | " << ((msg)?msg:"") << endl;
+  exit(0);
+}
+
+//////////////////////////////////////////////////////////////////////
+// synthetic meshes
+
+// triangulated N x N grid of quads; if shuffle is true the vertex
+// indices are randomly permuted, as in scans with no vertex locality;
+// if coord is not null it is filled with the vertex coordinates
+int makeGrid(const int N, const bool shuffle, vector<int>& coordIndex,
+             vector<float>* coord=nullptr) {
+  const int nV = (N+1)*(N+1);
+  vector<int> perm(nV);
+  iota(perm.begin(),perm.end(),0);
+  if(shuffle) {
+    mt19937 rng(1234);
+    std::shuffle(perm.begin(),perm.end(),rng);
+  }
+  if(coord!=nullptr) {
+    coord->assign(3*nV,0.0f);
+    for(int i=0;i<=N;i++)
+      for(int j=0;j<=N;j++) {
+        const int iV = perm[i*(N+1)+j];
+        (*coord)[3*iV  ] = static_cast<float>(j);
+        (*coord)[3*iV+1] = static_cast<float>(i);
+      }
+  }
+  coordIndex.clear();
+  coordIndex.reserve(8*N*N);
+  for(int i=0;i<N;i++) {
+    for(int j=0;j<N;j++) {
+      int iV00 = perm[(i  )*(N+1)+(j  )];
+      int iV01 = perm[(i  )*(N+1)+(j+1)];
+      int iV10 = perm[(i+1)*(N+1)+(j  )];
+      int iV11 = perm[(i+1)*(N+1)+(j+1)];
+      coordIndex.insert(coordIndex.end(),{iV00,iV01,iV11,-1});
+      coordIndex.insert(coordIndex.end(),{iV00,iV11,iV10,-1});
+    }
+  }
+  return nV;
+}
+
+// - the generators below fill coordIndex with a triangle mesh of
+//   about nC corners, face separators included, and return the number
+//   of vertices
+
+// subdivided icosahedron; a closed manifold sphere where all but 12
+// vertices have valence 6
+int makeIcosphere(const long nC, vector<int>& coordIndex) {
+  coordIndex = {
+     0,11, 5,-1,  0, 5, 1,-1,  0, 1, 7,-1,  0, 7,10,-1,  0,10,11,-1,
+     1, 5, 9,-1,  5,11, 4,-1, 11,10, 2,-1, 10, 7, 6,-1,  7, 1, 8,-1,
+     3, 9, 4,-1,  3, 4, 2,-1,  3, 2, 6,-1,  3, 6, 8,-1,  3, 8, 9,-1,
+     4, 9, 5,-1,  2, 4,11,-1,  6, 2,10,-1,  8, 6, 7,-1,  9, 8, 1,-1
+  };
+  int nV = 12;
+  // each level splits every triangle into four, with a new vertex per
+  // edge, numbered after the old ones in edge order
+  while(4*static_cast<long>(coordIndex.size())<=nC) {
+    Graph edges(nV);
+    vector<int> subdivided;
+    subdivided.reserve(4*coordIndex.size());
+    for(size_t iC=0;iC<coordIndex.size();iC+=4) {
+      const int iV0 = coordIndex[iC], iV1 = coordIndex[iC+1], iV2 = coordIndex[iC+2];
+      const int iV01 = nV+edges.insertEdge(iV0,iV1);
+      const int iV12 = nV+edges.insertEdge(iV1,iV2);
+      const int iV20 = nV+edges.insertEdge(iV2,iV0);
+      subdivided.insert(subdivided.end(),{ iV0,iV01,iV20,-1, iV01, iV1,iV12,-1,
+                                          iV20,iV12, iV2,-1, iV01,iV12,iV20,-1 });
+    }
+    nV += edges.getNumberOfEdges();
+    coordIndex.swap(subdivided);
+  }
+  return nV;
+}
+
+// triangulated N x N grid of quads with the opposite sides identified;
+// a closed manifold torus where every vertex has valence 6
+int makeTorus(const long nC, vector<int>& coordIndex) {
+  const int N = max(3,static_cast<int>(lround(sqrt(nC/8.0))));
+  coordIndex.clear();
+  coordIndex.reserve(8*static_cast<size_t>(N)*N);
+  for(int i=0;i<N;i++) {
+    for(int j=0;j<N;j++) {
+      int iV00 = ((i  )  )*N+((j  )  );
+      int iV01 = ((i  )  )*N+((j+1)%N);
+      int iV10 = ((i+1)%N)*N+((j  )  );
+      int iV11 = ((i+1)%N)*N+((j+1)%N);
+      coordIndex.insert(coordIndex.end(),{iV00,iV01,iV11,-1});
+      coordIndex.insert(coordIndex.end(),{iV00,iV11,iV10,-1});
+    }
+  }
+  return N*N;
+}
+
+// chain of books of 3 to 6 triangles sharing a singular hinge edge;
+// consecutive hinges share a vertex, which is singular as well
+int makeFans(const long nC, vector<int>& coordIndex) {
+  const long nB = max(1L,nC/18);
+  coordIndex.clear();
+  coordIndex.reserve(nC+24);
+  int nV = static_cast<int>(nB)+1; // hinge vertices
+  for(long iB=0;iB<nB;iB++) {
+    const int iV0 = static_cast<int>(iB), iV1 = iV0+1;
+    for(long k=0;k<3+iB%4;k++)
+      coordIndex.insert(coordIndex.end(),{iV0,iV1,nV++,-1});
+  }
+  return nV;
+}
+
+// random triangles, with two faces per vertex on average as in a
+// closed mesh; most edges are boundary edges
+int makeSoup(const long nC, vector<int>& coordIndex) {
+  const long nF = max(1L,nC/4);
+  const int  nV = static_cast<int>(max(3L,nF/2));
+  mt19937 rng(1234);
+  uniform_int_distribution<int> vertex(0,nV-1);
+  coordIndex.clear();
+  coordIndex.reserve(4*nF);
+  for(long iF=0;iF<nF;iF++) {
+    int iV0 = vertex(rng), iV1, iV2;
+    do { iV1 = vertex(rng); } while(iV1==iV0);
+    do { iV2 = vertex(rng); } while(iV2==iV0 || iV2==iV1);
+    coordIndex.insert(coordIndex.end(),{iV0,iV1,iV2,-1});
+  }
+  return nV;
+}
+
+// randomly permutes the vertex indices, as in scans with no vertex
+// locality
+void shuffleVertices(const int nV, vector<int>& coordIndex) {
+  vector<int> perm(nV);
+  iota(perm.begin(),perm.end(),0);
+  mt19937 rng(1234);
+  std::shuffle(perm.begin(),perm.end(),rng);
+  for(int& iV : coordIndex)
+    if(iV>=0) iV = perm[iV];
+}
+
+// builds the mesh selected by the -mesh and -corners options
+int makeMesh(const Data& D, vector<int>& coordIndex) {
+  const long nC = (D._corners>0)?D._corners:8L*D._gridSize*D._gridSize;
+  int nV = 0;
+  if(D._mesh=="grid") {
+    const int N = max(1,static_cast<int>(lround(sqrt(nC/8.0))));
+    return makeGrid(N,D._shuffle,coordIndex);
+  } else if(D._mesh=="icosphere") {
+    nV = makeIcosphere(nC,coordIndex);
+  } else if(D._mesh=="torus") {
+    nV = makeTorus(nC,coordIndex);
+  } else if(D._mesh=="fans") {
+    nV = makeFans(nC,coordIndex);
+  } else if(D._mesh=="soup") {
+    nV = makeSoup(nC,coordIndex);
+  } else {
+    error("unknown mesh");
+  }
+  if(D._shuffle) shuffleVertices(nV,coordIndex);
+  return nV;
+}
+
+// half-edge (src,dst) vertex pairs in corner order, one per corner
+// which is not a face separator
+void makeHalfEdges(const vector<int>& coordIndex, vector<pair<int,int>>& halfEdge) {
+  const int nC = static_cast<int>(coordIndex.size());
+  halfEdge.clear();
+  for(int iC0=0,iC1=0;iC1<nC;iC1++) {
+    if(coordIndex[iC1]>=0) continue;
+    for(int iC=iC0;iC<iC1;iC++)
+      halfEdge.emplace_back(coordIndex[iC],coordIndex[(iC+1<iC1)?iC+1:iC0]);
+    iC0 = iC1+1;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+// timing
+
+double seconds(const chrono::steady_clock::time_point& t0) {
+  return chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+}
+
+//////////////////////////////////////////////////////////////////////
+// memory
+
+// heap bytes in use by the process; 0 if not available
+// - the memory used by a data structure is measured as the difference
+//   before and after building it
+// - measured with the C library allocator statistics, which count
+//   all the allocation forms, rather than by replacing the global
+//   operator new and delete
+size_t heapBytes() {
+#if defined(__GLIBC__) && (__GLIBC__>2 || (__GLIBC__==2 && __GLIBC_MINOR__>=33))
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks+info.hblkhd;
+#else
+  return 0;
+#endif
+}
+
+// peak resident set size of the process in bytes; 0 if not available
+size_t peakRss() {
+#if defined(__APPLE__)
+  struct rusage usage;
+  return (getrusage(RUSAGE_SELF,&usage)==0)?static_cast<size_t>(usage.ru_maxrss):0;
+#elif defined(__unix__)
+  struct rusage usage;
+  return (getrusage(RUSAGE_SELF,&usage)==0)?static_cast<size_t>(usage.ru_maxrss)*1024:0;
+#else
+  return 0;
+#endif
+}
+
+const char* indexName(const Edges::Index index) {
+  switch(index) {
+  case Edges::LINKED_LIST: return "LINKED_LIST";
+  case Edges::HASH:        return "HASH";
+  case Edges::SORTED:      return "SORTED";
+  }
+  return "?";
+}
+
+// - inserts the half edges one at a time, as HalfEdges does
+// - bulk inserts the same half edges with Graph::insertEdges, and
+//   then looks every one of them up again
+// - builds the adjacency of the bulk graph, and checks it against
+//   getEdge
+// - returns false if the edge numbering differs from the reference
+bool benchEdges(const Data& D, const int nV,
+                const vector<pair<int,int>>& halfEdge,
+                const Edges::Index index, const vector<int>& reference) {
+  const int nH = static_cast<int>(halfEdge.size());
+  double tInsert = 1e30, tLookup = 1e30, tBulk = 1e30, tAdjacency = 1e30;
+  bool   same    = true;
+  long   check   = 0;
+  for(int r=0;r<D._repeat;r++) {
+    Graph graph(nV,index);
+    auto t0 = chrono::steady_clock::now();
+    for(const auto& [iV0,iV1] : halfEdge)
+      graph.insertEdge(iV0,iV1);
+    tInsert = min(tInsert,seconds(t0));
+
+    Graph bulk(nV,index);
+    vector<int> edgeIndex;
+    t0 = chrono::steady_clock::now();
+    bulk.insertEdges(halfEdge,&edgeIndex);
+    tBulk = min(tBulk,seconds(t0));
+    if(!reference.empty() && edgeIndex!=reference) same = false;
+
+    t0 = chrono::steady_clock::now();
+    for(int h=0;h<nH;h++) {
+      int iE = bulk.getEdge(halfEdge[h].first,halfEdge[h].second);
+      check += iE;
+      if(!reference.empty() && iE!=reference[h]) same = false;
+    }
+    tLookup = min(tLookup,seconds(t0));
+
+    t0 = chrono::steady_clock::now();
+    bulk.buildAdjacency();
+    tAdjacency = min(tAdjacency,seconds(t0));
+    long nA = 0;
+    for(int iV=0;iV<nV;iV++) {
+      span<const int> neighbor = bulk.getNeighbors(iV);
+      span<const int> edge     = bulk.getNeighborEdges(iV);
+      nA += bulk.getDegree(iV);
+      for(size_t j=0;j<neighbor.size();j++)
+        if(bulk.getEdge(iV,neighbor[j])!=edge[j] ||
+           (j>0 && neighbor[j-1]>=neighbor[j])) same = false;
+    }
+    if(nA!=2L*bulk.getNumberOfEdges()) same = false;
+  }
+  cout << "  " << indexName(index) << " {" << endl;
+  cout << "    insertEdge  = " << tInsert << " s ("
+       << nH/tInsert*1e-6 << " M half-edges/s)" << endl;
+  cout << "    insertEdges = " << tBulk << " s ("
+       << nH/tBulk*1e-6 << " M half-edges/s)" << endl;
+  cout << "    getEdge     = " << tLookup << " s ("
+       << nH/tLookup*1e-6 << " M half-edges/s)" << endl;
+  cout << "    adjacency   = " << tAdjacency << " s" << endl;
+  cout << "    sameEdges   = " << tv(same) << endl;
+  if(D._debug)
+    cout << "    checksum    = " << check << endl;
+  cout << "  } " << indexName(index) << endl;
+  return same;
+}
+
+const char* compressionName(const Partition::Compression compression) {
+  switch(compression) {
+  case Partition::COMPRESSION: return "COMPRESSION";
+  case Partition::HALVING:     return "HALVING";
+  case Partition::SPLITTING:   return "SPLITTING";
+  }
+  return "";
+}
+
+// - joins the ends of every half edge, finds the root of every vertex
+//   with findAll, and then queries all the roots again with
+//   findNoCompress on all the threads
+// - returns false if the labels differ from the reference
+bool benchPartition(const Data& D, const int nV,
+                    const vector<pair<int,int>>& halfEdge,
+                    const Partition::Compression compression,
+                    vector<int>& reference) {
+  double tJoin = 1e30, tFindAll = 1e30, tRead = 1e30;
+  bool   same  = true;
+  int    nParts = 0;
+  for(int r=0;r<D._repeat;r++) {
+    Partition partition(nV,compression);
+    auto t0 = chrono::steady_clock::now();
+    for(const auto& [iV0,iV1] : halfEdge)
+      partition.join(iV0,iV1);
+    tJoin = min(tJoin,seconds(t0));
+    nParts = partition.getNumberOfParts();
+
+    vector<int> root(nV);
+    t0 = chrono::steady_clock::now();
+    partition.findAll(root);
+    tFindAll = min(tFindAll,seconds(t0));
+
+    vector<int> readRoot(nV);
+    t0 = chrono::steady_clock::now();
+    Parallel::forChunks(nV,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+      for(int64_t i=begin;i<end;i++)
+        readRoot[i] = partition.findNoCompress(static_cast<int>(i));
+    });
+    tRead = min(tRead,seconds(t0));
+    if(readRoot!=root) same = false;
+
+    vector<int> label = partition.compactLabels();
+    if(reference.empty()) reference = label;
+    else if(label!=reference) same = false;
+  }
+  const double nH = static_cast<double>(halfEdge.size());
+  cout << "  " << compressionName(compression) << " {" << endl;
+  cout << "    join           = " << tJoin << " s ("
+       << nH/tJoin*1e-6 << " M joins/s)" << endl;
+  cout << "    findAll        = " << tFindAll << " s" << endl;
+  cout << "    findNoCompress = " << tRead << " s" << endl;
+  cout << "    nParts         = " << nParts << endl;
+  cout << "    sameLabels     = " << tv(same) << endl;
+  cout << "  } " << compressionName(compression) << endl;
+  return same;
+}
+
+// builds HalfEdges with the serial passes (1 thread) and with the
+// sort based builder on nThreads threads, and compares the results
+bool benchHalfEdges(const Data& D, const int nV, const vector<int>& coordIndex,
+                    const int nThreads) {
+  const int nC = static_cast<int>(coordIndex.size());
+  double tSerial = 1e30, tSorted = 1e30;
+  bool   same    = true;
+  for(int r=0;r<D._repeat;r++) {
+    Parallel::setNumberOfThreads(1);
+    auto t0 = chrono::steady_clock::now();
+    HalfEdges serial(nV,coordIndex);
+    tSerial = min(tSerial,seconds(t0));
+
+    Parallel::setNumberOfThreads(nThreads);
+    t0 = chrono::steady_clock::now();
+    HalfEdges sorted(nV,coordIndex);
+    tSorted = min(tSorted,seconds(t0));
+
+    if(r>0) continue;
+    const int nE = serial.getNumberOfEdges();
+    if(sorted.getNumberOfEdges()!=nE) same = false;
+    for(int iE=0;iE<nE && same;iE++) {
+      if(serial.getVertex0(iE)!=sorted.getVertex0(iE) ||
+         serial.getVertex1(iE)!=sorted.getVertex1(iE) ||
+         serial.getNumberOfEdgeHalfEdges(iE)!=sorted.getNumberOfEdgeHalfEdges(iE))
+        same = false;
+      for(int j=0;j<serial.getNumberOfEdgeHalfEdges(iE) && same;j++)
+        if(serial.getEdgeHalfEdge(iE,j)!=sorted.getEdgeHalfEdge(iE,j))
+          same = false;
+    }
+    for(int iC=0;iC<nC && same;iC++)
+      if(serial.getTwin(iC)!=sorted.getTwin(iC) ||
+         serial.getFace(iC)!=sorted.getFace(iC))
+        same = false;
+  }
+  cout << "  HalfEdges {" << endl;
+  cout << "    threads     = " << nThreads << endl;
+  cout << "    serial      = " << tSerial << " s ("
+       << nC/tSerial*1e-6 << " M corners/s)" << endl;
+  cout << "    sorted      = " << tSorted << " s ("
+       << nC/tSorted*1e-6 << " M corners/s)" << endl;
+  cout << "    sameResult  = " << tv(same) << endl;
+  cout << "  } HalfEdges" << endl;
+  return same;
+}
+
+// - golden dump of the topology of a PolygonMesh built with index
+//   type T: the global counts of its topology summary, the edges and
+//   their classes, the vertex classes and parts, the twin, face, and
+//   part of every corner, and the boundary loops
+// - the indices are widened to int64_t, with IndexTraits<T>::none
+//   written as -1, so that the dumps of all the index types can be
+//   compared directly
+template<class T>
+vector<int64_t> dumpTopology(const int nV, const vector<int>& coordIndex) {
+  auto wide = [](const T i) {
+    return (i==IndexTraits<T>::none)?int64_t(-1):static_cast<int64_t>(i);
+  };
+  vector<T> index(coordIndex.size());
+  for(size_t i=0;i<coordIndex.size();i++)
+    index[i] = (coordIndex[i]<0)?IndexTraits<T>::none:static_cast<T>(coordIndex[i]);
+  PolygonMeshT<T> mesh(static_cast<T>(nV),index);
+  mesh.buildBoundaryLoops();
+
+  const MeshTopologySummaryT<T>& summary = mesh.getTopologySummary();
+  vector<int64_t> dump = {
+    wide(summary.getNumberOfVertices()),
+    wide(summary.getNumberOfEdges()),
+    wide(summary.getNumberOfFaces()),
+    wide(summary.getNumberOfCorners()),
+    wide(summary.getNumberOfBoundaryVertices()),
+    wide(summary.getNumberOfSingularVertices()),
+    wide(summary.getNumberOfBoundaryEdges()),
+    wide(summary.getNumberOfRegularEdges()),
+    wide(summary.getNumberOfSingularEdges()),
+    summary.getEulerCharacteristic(),
+    wide(mesh.getNumberOfParts()),
+    wide(mesh.getNumberOfBoundaryLoops())
+  };
+  for(T iE=0;iE<mesh.getNumberOfEdges();iE++)
+    dump.insert(dump.end(),{ wide(mesh.getVertex0(iE)), wide(mesh.getVertex1(iE)),
+                             static_cast<int64_t>(summary.getEdgeClass(iE)) });
+  for(T iV=0;iV<mesh.getNumberOfVertices();iV++)
+    dump.insert(dump.end(),{ static_cast<int64_t>(summary.getVertexClass(iV)),
+                             wide(mesh.getNumberOfVertexParts(iV)) });
+  for(T iC=0;iC<mesh.getNumberOfCorners();iC++)
+    dump.insert(dump.end(),{ wide(mesh.getTwin(iC)), wide(mesh.getFace(iC)),
+                             wide(mesh.getCornerPart(iC)) });
+  for(T iL=0;iL<mesh.getNumberOfBoundaryLoops();iL++) {
+    dump.push_back(mesh.isBoundaryLoopClosed(iL)?1:0);
+    for(const T iC : mesh.getBoundaryLoopCorners(iL))
+      dump.push_back(wide(iC));
+  }
+  return dump;
+}
+
+// compares the golden dumps of the int, uint32_t, and int64_t
+// instantiations of the topology classes, on 1 and nThreads threads;
+// returns false if any of them differ
+bool benchIndexTypes(const int nV, const vector<int>& coordIndex, const int nThreads) {
+  const char* typeName[] = { "int", "uint32_t", "int64_t" };
+  vector<int64_t> reference;
+  bool same = true;
+  cout << "  IndexTypes {" << endl;
+  for(const int threads : { 1, nThreads }) {
+    Parallel::setNumberOfThreads(threads);
+    for(int type=0;type<3;type++) {
+      auto t0 = chrono::steady_clock::now();
+      const vector<int64_t> dump =
+        (type==0)?dumpTopology<int>(nV,coordIndex):
+        (type==1)?dumpTopology<uint32_t>(nV,coordIndex):
+                  dumpTopology<int64_t>(nV,coordIndex);
+      const double t = seconds(t0);
+      if(reference.empty()) reference = dump;
+      const bool ok = (dump==reference);
+      same &= ok;
+      cout << "    " << typeName[type] << " x" << threads << " = " << t
+           << " s (" << dump.size() << " values, "
+           << ((ok)?"same":"DIFFERENT") << ")" << endl;
+    }
+  }
+  Parallel::setNumberOfThreads(nThreads);
+  cout << "    sameDump    = " << tv(same) << endl;
+  cout << "  } IndexTypes" << endl;
+  return same;
+}
+
+// one timing of the topology benchmark
+class Record {
+public:
+  string _structure;
+  string _operation;
+  double _seconds;
+  double _bytesPerCorner; // only for the construction
+};
+
+// - times the construction of each topology class, keeping the best of
+//   D._repeat runs, and one pass of per-element queries over it
+// - the bytes per corner are the heap bytes held by the structure
+//   after construction, divided by the number of corners
+void benchTopology(const Data& D, const int nV, const vector<int>& coordIndex,
+                   const vector<pair<int,int>>& halfEdge, vector<Record>& record) {
+  const double nC = static_cast<double>(coordIndex.size());
+  long check = 0;
+  // build() returns the structure, and query(structure) runs the
+  // queries over it
+  auto bench = [&](const char* structure, const char* queries,
+                   auto&& build, auto&& query) {
+    double tBuild = 1e30, tQuery = 1e30, bytes = 0.0;
+    for(int r=0;r<D._repeat;r++) {
+      const size_t heap0 = heapBytes();
+      auto t0 = chrono::steady_clock::now();
+      auto object = build();
+      tBuild = min(tBuild,seconds(t0));
+      bytes = static_cast<double>(heapBytes())-static_cast<double>(heap0);
+      t0 = chrono::steady_clock::now();
+      check += query(*object);
+      tQuery = min(tQuery,seconds(t0));
+    }
+    record.push_back({structure,"build",tBuild,bytes/nC});
+    record.push_back({structure,queries,tQuery,0.0});
+  };
+
+  bench("Faces","getCornerFace+getNextCorner",
+        [&]() { return make_unique<Faces>(nV,coordIndex); },
+        [&](const Faces& faces) {
+          long sum = 0;
+          for(int iC=0;iC<faces.getNumberOfCorners();iC++)
+            sum += faces.getCornerFace(iC)+faces.getNextCorner(iC);
+          return sum;
+        });
+
+  bench("Edges","getEdge",
+        [&]() {
+          auto graph = make_unique<Graph>(nV);
+          for(const auto& [iV0,iV1] : halfEdge)
+            graph->insertEdge(iV0,iV1);
+          return graph;
+        },
+        [&](const Graph& graph) {
+          long sum = 0;
+          for(const auto& [iV0,iV1] : halfEdge)
+            sum += graph.getEdge(iV0,iV1);
+          return sum;
+        });
+
+  bench("HalfEdges","getTwin+getFace+getNext+getPrev",
+        [&]() { return make_unique<HalfEdges>(nV,coordIndex); },
+        [&](const HalfEdges& mesh) {
+          long sum = 0;
+          for(int iC=0;iC<mesh.getNumberOfCorners();iC++)
+            sum += mesh.getTwin(iC)+mesh.getFace(iC)+mesh.getNext(iC)+mesh.getPrev(iC);
+          return sum;
+        });
+
+  bench("PolygonMesh","isBoundary/Singular Vertex/Edge",
+        [&]() { return make_unique<PolygonMesh>(nV,coordIndex); },
+        [&](const PolygonMesh& mesh) {
+          long sum = 0;
+          for(int iV=0;iV<mesh.getNumberOfVertices();iV++)
+            sum += mesh.isBoundaryVertex(iV)+mesh.isSingularVertex(iV);
+          for(int iE=0;iE<mesh.getNumberOfEdges();iE++)
+            sum += mesh.isBoundaryEdge(iE)+mesh.isSingularEdge(iE);
+          return sum;
+        });
+
+  bench("Partition","findNoCompress",
+        [&]() {
+          auto partition = make_unique<Partition>(nV);
+          for(const auto& [iV0,iV1] : halfEdge)
+            partition->join(iV0,iV1);
+          return partition;
+        },
+        [&](const Partition& partition) {
+          long sum = 0;
+          for(int iV=0;iV<nV;iV++)
+            sum += partition.findNoCompress(iV);
+          return sum;
+        });
+
+  cout << "  Topology {" << endl;
+  for(const Record& r : record) {
+    cout << "    " << r._structure << "." << r._operation << " = " << r._seconds
+         << " s (" << nC/r._seconds*1e-6 << " M corners/s";
+    if(r._operation=="build")
+      cout << ", " << r._bytesPerCorner << " bytes/corner";
+    cout << ")" << endl;
+  }
+  cout << "    peakRss = " << peakRss()/1048576.0 << " MB" << endl;
+  if(D._debug)
+    cout << "    checksum = " << check << endl;
+  cout << "  } Topology" << endl;
+}
+
+// writes the records of benchTopology as CSV or JSON, depending on the
+// extension of the file name
+bool saveTopology(const Data& D, const int nV, const long nC,
+                  const vector<Record>& record) {
+  ofstream out(D._outFile);
+  if(!out) return false;
+  const bool json = D._outFile.size()>=5 &&
+    D._outFile.compare(D._outFile.size()-5,5,".json")==0;
+  const size_t rss = peakRss();
+  if(json) out << "[" << endl;
+  else     out << "mesh,nV,nC,threads,structure,operation,seconds,cornersPerSecond,bytesPerCorner,peakRss" << endl;
+  for(size_t i=0;i<record.size();i++) {
+    const Record& r = record[i];
+    const double cps = nC/r._seconds;
+    if(json)
+      out << "  {\"mesh\":\"" << D._mesh << "\",\"nV\":" << nV << ",\"nC\":" << nC
+          << ",\"threads\":" << D._threads
+          << ",\"structure\":\"" << r._structure << "\",\"operation\":\"" << r._operation
+          << "\",\"seconds\":" << r._seconds << ",\"cornersPerSecond\":" << cps
+          << ",\"bytesPerCorner\":" << r._bytesPerCorner << ",\"peakRss\":" << rss
+          << "}" << ((i+1<record.size())?",":"") << endl;
+    else
+      out << D._mesh << "," << nV << "," << nC << "," << D._threads << ","
+          << r._structure << "," << r._operation << "," << r._seconds << ","
+          << cps << "," << r._bytesPerCorner << "," << rss << endl;
+  }
+  if(json) out << "]" << endl;
+  return static_cast<bool>(out);
+}
+
+// average number of vertex cache misses per face of a FIFO cache of
+// 32 entries
+double cacheMissRatio(const vector<int>& coordIndex, const int nV) {
+  const int cacheSize = 32;
+  vector<long> stamp(nV,-cacheSize-1);
+  long time = 0, nMiss = 0, nF = 0;
+  for(const int iV : coordIndex) {
+    if(iV<0) { nF++; continue; }
+    if(stamp[iV]<time-cacheSize) { stamp[iV] = time++; nMiss++; }
+  }
+  return (nF>0)?static_cast<double>(nMiss)/nF:0.0;
+}
+
+// - times two kernels that access coord and the vertex arrays through
+//   coordIndex, per vertex normals and the serial HalfEdges
+//   construction, on a shuffled grid, before and after reordering it
+//   with each one of the SceneGraphProcessor reordering operators
+// - returns false if a reordering changes the number of vertices,
+//   faces, or corners
+bool benchReorder(const Data& D) {
+  enum Order { INPUT=0, MORTON, HILBERT, HILBERT_FACES, VERTEX_CACHE };
+  const char* orderName[] = { "input", "morton", "hilbert", "hilbertFaces", "vertexCache" };
+
+  vector<int>   coordIndex0;
+  vector<float> coord0;
+  const int nV = makeGrid(D._gridSize,true,coordIndex0,&coord0);
+
+  bool   same = true;
+  double tNormal0 = 0.0, tHalfEdges0 = 0.0;
+  cout << "  Reorder {" << endl;
+  for(int order=INPUT;order<=VERTEX_CACHE;order++) {
+    SceneGraph wrl;
+    Shape* shape = new Shape();
+    wrl.addChild(shape);
+    IndexedFaceSet* ifs = new IndexedFaceSet();
+    shape->setGeometry(ifs);
+    ifs->getCoord()      = coord0;
+    ifs->getCoordIndex() = coordIndex0;
+    SceneGraphProcessor processor(wrl);
+
+    auto t0 = chrono::steady_clock::now();
+    switch(order) {
+    case MORTON:        processor.reorderVerticesMorton();  break;
+    case HILBERT:       processor.reorderVerticesHilbert(); break;
+    case HILBERT_FACES: processor.reorderVerticesHilbert();
+                        processor.reorderFacesHilbert();    break;
+    case VERTEX_CACHE:  processor.reorderVerticesHilbert();
+                        processor.reorderFacesVertexCache(); break;
+    default: break;
+    }
+    const double tReorder = seconds(t0);
+    const vector<int>& coordIndex = ifs->getCoordIndex();
+    if(coordIndex.size()!=coordIndex0.size() ||
+       ifs->getCoord().size()!=coord0.size()) same = false;
+
+    double tNormal = 1e30, tHalfEdges = 1e30;
+    Parallel::setNumberOfThreads(1);
+    for(int r=0;r<D._repeat;r++) {
+      processor.normalClear();
+      t0 = chrono::steady_clock::now();
+      processor.computeNormalPerVertex();
+      tNormal = min(tNormal,seconds(t0));
+      t0 = chrono::steady_clock::now();
+      HalfEdges halfEdges(nV,coordIndex);
+      tHalfEdges = min(tHalfEdges,seconds(t0));
+    }
+    Parallel::setNumberOfThreads(D._threads);
+    if(order==INPUT) { tNormal0 = tNormal; tHalfEdges0 = tHalfEdges; }
+
+    cout << "    " << orderName[order] << " {" << endl;
+    cout << "      reorder     = " << tReorder << " s" << endl;
+    cout << "      acmr        = " << cacheMissRatio(coordIndex,nV) << endl;
+    cout << "      normals     = " << tNormal << " s (x"
+         << tNormal0/tNormal << ")" << endl;
+    cout << "      HalfEdges   = " << tHalfEdges << " s (x"
+         << tHalfEdges0/tHalfEdges << ")" << endl;
+    cout << "    } " << orderName[order] << endl;
+  }
+  cout << "    sameSize    = " << tv(same) << endl;
+  cout << "  } Reorder" << endl;
+  return same;
+}
+
+// - checks the half-edge invariants of an EditableMesh through its
+//   public interface: twin, next, and prev links, face loops, vertex
+//   rings, boundary vertex half-edges, and element counts
+// - the face loops and vertex rings are walked with a bound, so that
+//   a broken link is reported rather than followed forever
+bool checkEditableMesh(const EditableMesh& mesh) {
+  const int nH = 2*mesh.getEdgeRange();
+  int nV = 0, nE = 0, nF = 0;
+  for(int iE=0;iE<mesh.getEdgeRange();iE++) {
+    if(!mesh.isEdge(iE)) continue;
+    nE++;
+    if(mesh.getFace(2*iE)<0 && mesh.getFace(2*iE+1)<0) return false;
+    for(int j=0;j<2;j++) {
+      const int iH = mesh.getEdgeHalfEdge(iE,j);
+      if(mesh.getEdge(iH)!=iE || mesh.getTwin(mesh.getTwin(iH))!=iH ||
+         mesh.getNext(mesh.getPrev(iH))!=iH || mesh.getPrev(mesh.getNext(iH))!=iH ||
+         mesh.getSrc(mesh.getNext(iH))!=mesh.getDst(iH) ||
+         mesh.getDst(iH)!=mesh.getSrc(mesh.getTwin(iH)) ||
+         mesh.getFace(mesh.getNext(iH))!=mesh.getFace(iH) ||
+         !mesh.isVertex(mesh.getSrc(iH)) ||
+         (mesh.getFace(iH)>=0 && !mesh.isFace(mesh.getFace(iH))))
+        return false;
+    }
+  }
+  // faces must not repeat a vertex
+  vector<int> faceOfVertex(static_cast<size_t>(mesh.getVertexRange()),-1);
+  for(int iF=0;iF<mesh.getFaceRange();iF++) {
+    if(!mesh.isFace(iF)) continue;
+    nF++;
+    const int iH0 = mesh.getFaceHalfEdge(iF);
+    int n = 0, iH = iH0;
+    do {
+      if(mesh.getFace(iH)!=iF || ++n>nH) return false;
+      int& mark = faceOfVertex[static_cast<size_t>(mesh.getSrc(iH))];
+      if(mark==iF) return false;
+      mark = iF;
+      iH = mesh.getNext(iH);
+    } while(iH!=iH0);
+    if(n<3 || n!=mesh.getFaceSize(iF)) return false;
+  }
+  for(int iV=0;iV<mesh.getVertexRange();iV++) {
+    if(!mesh.isVertex(iV)) continue;
+    nV++;
+    const int iH0 = mesh.getVertexHalfEdge(iV);
+    if(iH0<0) continue;
+    int n = 0, iH = iH0;
+    bool boundary = false;
+    do {
+      if(mesh.getSrc(iH)!=iV || ++n>nH) return false;
+      boundary |= mesh.isBoundaryHalfEdge(iH);
+      iH = mesh.getTwin(mesh.getPrev(iH));
+    } while(iH!=iH0);
+    if(n!=mesh.getValence(iV) || boundary!=mesh.isBoundaryHalfEdge(iH0) ||
+       boundary!=mesh.isBoundaryVertex(iV))
+      return false;
+  }
+  return nV==mesh.getNumberOfVertices() && nE==mesh.getNumberOfEdges() &&
+         nF==mesh.getNumberOfFaces();
+}
+
+// - runs each one of the EditableMesh operators over a grid with
+//   coordinates, and checks the half-edge invariants and the Euler
+//   characteristic, which the operators preserve, after each pass
+// - the mesh is imported from and exported to an IndexedFaceSet; the
+//   unedited mesh must be reproduced exactly, and the edited one must
+//   be rebuilt from its export with the same counts
+// - returns false if a check fails
+bool benchEditableMesh(const Data& D) {
+  vector<int>   coordIndex0;
+  vector<float> coord0;
+  makeGrid(D._gridSize,D._shuffle,coordIndex0,&coord0);
+
+  IndexedFaceSet ifs;
+  ifs.getCoord()      = coord0;
+  ifs.getCoordIndex() = coordIndex0;
+
+  bool same = true;
+  cout << "  EditableMesh {" << endl;
+
+  auto t0 = chrono::steady_clock::now();
+  EditableMesh mesh(ifs);
+  const double tBuild = seconds(t0);
+  IndexedFaceSet exported;
+  mesh.exportMesh(exported);
+  if(exported.getCoord()!=coord0 || exported.getCoordIndex()!=coordIndex0)
+    same = false;
+  cout << "    build       = " << tBuild << " s" << endl;
+  cout << "    roundTrip   = " << tv(same) << endl;
+
+  auto euler = [&]() {
+    return mesh.getNumberOfVertices()-mesh.getNumberOfEdges()+mesh.getNumberOfFaces();
+  };
+  const int chi = euler();
+  // runs one pass of an operator, and reports the number of
+  // successful edits and the checks
+  auto pass = [&](const char* name, auto&& edit) {
+    t0 = chrono::steady_clock::now();
+    const int nEdits = edit();
+    const double t = seconds(t0);
+    const bool ok = checkEditableMesh(mesh) && euler()==chi;
+    same &= ok;
+    cout << "    " << name << " = " << t << " s (" << nEdits << " edits, "
+         << ((ok)?"valid":"INVALID") << ")" << endl;
+  };
+
+  pass("flipEdge   ",[&]() {
+    int n = 0;
+    for(int iE=0;iE<mesh.getEdgeRange();iE+=3)
+      if(mesh.flipEdge(iE)) n++;
+    return n;
+  });
+
+  // each split edge is followed by splitting the quadrilaterals
+  // incident to the new vertex, to keep the mesh triangulated
+  pass("splitEdge   ",[&]() {
+    int n = 0;
+    vector<int> out;
+    const int nE = mesh.getEdgeRange();
+    for(int iE=0;iE<nE;iE+=7) {
+      const int iVm = mesh.splitEdge(iE);
+      if(iVm<0) continue;
+      n++;
+      out.clear();
+      const int iH0 = mesh.getVertexHalfEdge(iVm);
+      int iH = iH0;
+      do {
+        if(!mesh.isBoundaryHalfEdge(iH)) out.push_back(iH);
+        iH = mesh.getTwin(mesh.getPrev(iH));
+      } while(iH!=iH0);
+      for(const int iHm : out)
+        if(mesh.splitFace(iHm,mesh.getNext(mesh.getNext(iHm)))<0)
+          return -1;
+    }
+    return n;
+  });
+
+  pass("collapseEdge",[&]() {
+    int n = 0;
+    for(int iE=0;iE<mesh.getEdgeRange();iE+=5)
+      if(mesh.isEdge(iE) && mesh.collapseEdge(iE)>=0) n++;
+    return n;
+  });
+
+  pass("removeVertex",[&]() {
+    int n = 0;
+    for(int iV=0;iV<mesh.getVertexRange();iV+=11)
+      if(mesh.removeVertex(iV)>=0) n++;
+    return n;
+  });
+
+  // the free lists are reused by the following edits
+  pass("reuse       ",[&]() {
+    const int nV = mesh.getVertexRange(), nE = mesh.getEdgeRange();
+    int n = 0;
+    for(int iE=0;iE<nE;iE+=13)
+      if(mesh.isEdge(iE) && mesh.splitEdge(iE)>=0) n++;
+    if(mesh.getVertexRange()!=nV || mesh.getEdgeRange()!=nE) return -1;
+    return n;
+  });
+
+  // the exported mesh is rebuilt, and exported again unchanged
+  mesh.exportMesh(exported);
+  bool rebuilt = false;
+  try {
+    EditableMesh copy(exported);
+    IndexedFaceSet exported2;
+    copy.exportMesh(exported2);
+    rebuilt =
+      copy.getNumberOfVertices()==mesh.getNumberOfVertices() &&
+      copy.getNumberOfEdges()==mesh.getNumberOfEdges() &&
+      copy.getNumberOfFaces()==mesh.getNumberOfFaces() &&
+      checkEditableMesh(copy) &&
+      exported2.getCoord()==exported.getCoord() &&
+      exported2.getCoordIndex()==exported.getCoordIndex();
+  } catch(const std::exception& e) {
+    cout << "    " << e.what() << endl;
+  }
+  same &= rebuilt;
+  cout << "    rebuild     = " << tv(rebuilt) << endl;
+  cout << "  } EditableMesh" << endl;
+  return same;
+}
+
+//////////////////////////////////////////////////////////////////////
+int main(int argc, char **argv) {
+
+  Data D;
+
+  for(int i=1;i<argc;i++) {
+    if(string(argv[i])=="-h" || string(argv[i])=="-help") {
+      usage(D);
+    } else if(string(argv[i])=="-d" || string(argv[i])=="-debug") {
+      D._debug = !D._debug;
+    } else if(string(argv[i])=="-s" || string(argv[i])=="-shuffle") {
+      D._shuffle = !D._shuffle;
+    } else if((string(argv[i])=="-n" || string(argv[i])=="-gridSize") && i+1<argc) {
+      D._gridSize = atoi(argv[++i]);
+    } else if((string(argv[i])=="-r" || string(argv[i])=="-repeat") && i+1<argc) {
+      D._repeat = atoi(argv[++i]);
+    } else if((string(argv[i])=="-t" || string(argv[i])=="-threads") && i+1<argc) {
+      D._threads = atoi(argv[++i]);
+    } else if((string(argv[i])=="-m" || string(argv[i])=="-mesh") && i+1<argc) {
+      D._mesh = argv[++i];
+    } else if((string(argv[i])=="-c" || string(argv[i])=="-corners") && i+1<argc) {
+      D._corners = atol(argv[++i]);
+    } else if((string(argv[i])=="-o" || string(argv[i])=="-outFile") && i+1<argc) {
+      D._outFile = argv[++i];
+    } else {
+      error("unknown option");
+    }
+  }
+
+  if(D._gridSize<1) error("gridSize must be positive");
+  if(D._repeat<1)   error("repeat must be positive");
+
+  if(D._corners<0)  error("corners must be non-negative");
+
+  vector<int> coordIndex;
+  const int nV = makeMesh(D,coordIndex);
+  vector<pair<int,int>> halfEdge;
+  makeHalfEdges(coordIndex,halfEdge);
+
+  cout << "dgpBench {" << endl;
+  cout << "  mesh     = " << D._mesh << endl;
+  cout << "  gridSize = " << D._gridSize << endl;
+  cout << "  nV       = " << nV << endl;
+  cout << "  nC       = " << coordIndex.size() << endl;
+
+  // the linked-list representation provides the reference numbering
+  vector<int> reference;
+  {
+    Graph graph(nV,Edges::LINKED_LIST);
+    for(const auto& [iV0,iV1] : halfEdge)
+      reference.push_back(graph.insertEdge(iV0,iV1));
+    cout << "  nE       = " << graph.getNumberOfEdges() << endl;
+  }
+
+  bool same = true;
+  Parallel::setNumberOfThreads(D._threads);
+  same &= benchEdges(D,nV,halfEdge,Edges::LINKED_LIST,reference);
+  same &= benchEdges(D,nV,halfEdge,Edges::HASH,reference);
+  same &= benchEdges(D,nV,halfEdge,Edges::SORTED,reference);
+
+  vector<int> labels;
+  same &= benchPartition(D,nV,halfEdge,Partition::COMPRESSION,labels);
+  same &= benchPartition(D,nV,halfEdge,Partition::HALVING,labels);
+  same &= benchPartition(D,nV,halfEdge,Partition::SPLITTING,labels);
+
+  vector<Record> record;
+  benchTopology(D,nV,coordIndex,halfEdge,record);
+  if(D._outFile!="" && !saveTopology(D,nV,static_cast<long>(coordIndex.size()),record))
+    error("unable to write outFile");
+
+  same &= benchHalfEdges(D,nV,coordIndex,Parallel::getNumberOfThreads());
+  same &= benchIndexTypes(nV,coordIndex,Parallel::getNumberOfThreads());
+  same &= benchReorder(D);
+  same &= benchEditableMesh(D);
+
+  cout << "} dgpBench" << endl;
+
+  return (same)?0:-1;
+}
@@ -32,6 +32,9 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
 // SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <cfloat>
+#include <map>
 #include <string>
 #include <iostream>
 
@@ -44,12 +47,16 @@ using namespace std;
 #include <io/LoaderPly.hpp>
 #include <io/LoaderStl.hpp>
 #include <io/LoaderWrl.hpp>
+#include <io/MappedPly.hpp>
 #include <io/SaverPly.hpp>
 #include <io/SaverStl.hpp>
 #include <io/SaverWrl.hpp>
 
 #include <core/PolygonMesh.hpp>
 #include <core/PolygonMeshTest.hpp>
+#include <core/StreamingTopologySummary.hpp>
+
+#include <util/Parallel.hpp>
 
 #include "dgpPrt.hpp"
 
@@ -58,6 +65,13 @@ public:
   bool   _debug;
   bool   _binaryOutput;
   bool   _removeProperties;
+  bool   _weldVertices;
+  float  _weldEpsilon;
+  bool   _outOfCore;
+  int    _memoryBudget; // MB
+  bool   _inspect;
+  bool   _stream;
+  int    _threads; // 0 uses all the hardware threads
   string _inFile;
   string _outFile;
 public:
@@ -65,6 +79,13 @@ public:
     _debug(false),
     _binaryOutput(false),
     _removeProperties(false),
+    _weldVertices(false),
+    _weldEpsilon(0.0f),
+    _outOfCore(false),
+    _memoryBudget(256),
+    _inspect(false),
+    _stream(false),
+    _threads(0),
     _inFile(""),
     _outFile("")
   { }
@@ -74,6 +95,14 @@ void options(Data& D) {
   cout << "   -d|-debug               [" << tv(D._debug)            << "]" << endl;
   cout << "   -b|-binaryOutput        [" << tv(D._binaryOutput)     << "]" << endl;
   cout << "   -r|-removeProperties    [" << tv(D._removeProperties) << "]" << endl;
+  cout << "   -w|-weldVertices        [" << tv(D._weldVertices)     << "]" << endl;
+  cout << "   -e|-weldEpsilon E       [" << D._weldEpsilon          << "]" << endl;
+  cout << "   -x|-outOfCore           [" << tv(D._outOfCore)        << "]" << endl;
+  cout << "   -m|-memoryBudget MB     [" << D._memoryBudget         << "]" << endl;
+  cout << "   -i|-inspect             [" << tv(D._inspect)          << "]" << endl;
+  cout << "   -s|-stream              [" << tv(D._stream)           << "]" << endl;
+  cout << "   -t|-threads N           [" << D._threads              << "]"
+       << " 0 uses all the hardware threads" << endl;
 }
 
 void usage(Data& D) {
@@ -105,6 +134,25 @@ int main(int argc, char **argv) {
       D._binaryOutput = !D._binaryOutput;
     } else if(string(argv[i])=="-r" || string(argv[i])=="-removeProperties") {
       D._removeProperties = !D._removeProperties;
+    } else if(string(argv[i])=="-w" || string(argv[i])=="-weldVertices") {
+      D._weldVertices = !D._weldVertices;
+    } else if(string(argv[i])=="-e" || string(argv[i])=="-weldEpsilon") {
+      if(++i>=argc) error("no value for weldEpsilon");
+      D._weldEpsilon = static_cast<float>(atof(argv[i]));
+    } else if(string(argv[i])=="-x" || string(argv[i])=="-outOfCore") {
+      D._outOfCore = !D._outOfCore;
+    } else if(string(argv[i])=="-m" || string(argv[i])=="-memoryBudget") {
+      if(++i>=argc) error("no value for memoryBudget");
+      D._memoryBudget = atoi(argv[i]);
+      if(D._memoryBudget<1) error("memoryBudget must be positive");
+    } else if(string(argv[i])=="-i" || string(argv[i])=="-inspect") {
+      D._inspect = !D._inspect;
+    } else if(string(argv[i])=="-s" || string(argv[i])=="-stream") {
+      D._stream = !D._stream;
+    } else if(string(argv[i])=="-t" || string(argv[i])=="-threads") {
+      if(++i>=argc) error("no value for threads");
+      D._threads = atoi(argv[i]);
+      if(D._threads<0) error("threads must be non-negative");
     } else if(string(argv[i])[0]=='-') {
       error("unknown option");
     } else if(D._inFile=="") {
@@ -116,6 +164,10 @@ int main(int argc, char **argv) {
 
   if(D._inFile =="") error("no inFile");
 
+  // used by the chunked ASCII PLY parser, the sort based HalfEdges
+  // construction, and the other parallel passes
+  Parallel::setNumberOfThreads(D._threads);
+
   // if D._outFile is not specified then no output file will be written
   // if(D._outFile=="") error("no outFile");
 
@@ -132,6 +184,120 @@ int main(int argc, char **argv) {
 
   bool success;
 
+  //////////////////////////////////////////////////////////////////////
+  // inspect a binary PLY file through a memory mapping; only the
+  // pages holding the vertex coordinates are read
+
+  if(D._inspect) {
+    MappedPly mapped;
+    if(mapped.open(D._inFile.c_str())==false)
+      error("unable to map inFile as a binary PLY file with the system endianness");
+
+    cout << "MappedPly {" << endl;
+    for(const LoaderPly::FileElement& element : mapped.getLayout()) {
+      cout << "  element " << element.name << " " << element.nRecords << endl;
+      for(const LoaderPly::FileProperty& property : element.property) {
+        cout << "    property ";
+        if(property.list)
+          cout << "list " << Ply::Element::Property::getTypeName(property.listType) << " ";
+        cout << Ply::Element::Property::getTypeName(property.type) << " " << property.name << endl;
+      }
+    }
+    try {
+      MappedPly::View<float> x = mapped.getView<float>("vertex","x");
+      MappedPly::View<float> y = mapped.getView<float>("vertex","y");
+      MappedPly::View<float> z = mapped.getView<float>("vertex","z");
+      float bmin[3] = { FLT_MAX, FLT_MAX, FLT_MAX};
+      float bmax[3] = {-FLT_MAX,-FLT_MAX,-FLT_MAX};
+      for(size_t iV=0;iV<x.size();iV++) {
+        const float v[3] = {x[iV],y[iV],z[iV]};
+        for(int j=0;j<3;j++) {
+          bmin[j] = std::min(bmin[j],v[j]);
+          bmax[j] = std::max(bmax[j],v[j]);
+        }
+      }
+      cout << "  bboxMin = [ " << bmin[0] << " " << bmin[1] << " " << bmin[2] << " ]" << endl;
+      cout << "  bboxMax = [ " << bmax[0] << " " << bmax[1] << " " << bmax[2] << " ]" << endl;
+    } catch(const std::exception& e) {
+      cout << "  " << e.what() << endl;
+    }
+    cout << "} MappedPly" << endl;
+    return 0;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // stream the vertices and faces of an ASCII or binary PLY file in
+  // batches, in constant memory
+
+  if(D._stream) {
+    int64_t nBatches = 0, nV = 0, nF = 0, nCorners = 0;
+    float bmin[3] = { FLT_MAX, FLT_MAX, FLT_MAX};
+    float bmax[3] = {-FLT_MAX,-FLT_MAX,-FLT_MAX};
+    std::map<std::string,LoaderPly::RecordVisitor> visitor;
+    visitor["vertex"] = [&](Ply::Element& vertex, int64_t /* iFirst */, int nRecords) {
+      Ply::Element::Property* coord = vertex.getProperty("coord");
+      if(coord==nullptr) throw std::runtime_error("no vertex coordinates");
+      std::span<float> x = coord->as<float>();
+      for(size_t i=0;i<x.size();i++) {
+        bmin[i%3] = std::min(bmin[i%3],x[i]);
+        bmax[i%3] = std::max(bmax[i%3],x[i]);
+      }
+      nV += nRecords;
+      nBatches++;
+    };
+    visitor["face"] = [&](Ply::Element& face, int64_t /* iFirst */, int nRecords) {
+      Ply::Element::Property* coordIndex = face.getProperty("coordIndex");
+      if(coordIndex==nullptr) throw std::runtime_error("no face vertex indices");
+      nCorners += static_cast<int64_t>(coordIndex->getNumberOfValues())-nRecords;
+      nF += nRecords;
+      nBatches++;
+    };
+    try {
+      if(LoaderPly::loadRecords(D._inFile.c_str(),visitor)==false)
+        error("unable to stream records from PLY inFile");
+    } catch(const std::exception& e) {
+      error(e.what());
+    }
+
+    cout << "LoaderPly::loadRecords {" << endl;
+    cout << "  nBatches = " << nBatches << endl;
+    cout << "  nV       = " << nV << endl;
+    cout << "  nF       = " << nF << endl;
+    cout << "  nCorners = " << nCorners << endl;
+    if(nV>0) {
+      cout << "  bboxMin  = [ " << bmin[0] << " " << bmin[1] << " " << bmin[2] << " ]" << endl;
+      cout << "  bboxMax  = [ " << bmax[0] << " " << bmax[1] << " " << bmax[2] << " ]" << endl;
+    }
+    cout << "} LoaderPly::loadRecords" << endl;
+    return 0;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // out-of-core check of a binary PLY file; the faces are streamed
+  // from the file, and the mesh is never loaded
+
+  if(D._outOfCore) {
+    StreamingTopologySummary summary(static_cast<size_t>(D._memoryBudget)<<20);
+    int64_t nV = 0;
+    try {
+      summary.begin();
+      success = LoaderPly::loadFaces(D._inFile.c_str(),nV,[&](std::span<const int64_t> face) {
+        summary.addFace(face);
+      });
+      if(success)
+        summary.end(nV);
+    } catch(const std::exception& e) {
+      error(e.what());
+    }
+    if(success==false) error("unable to stream faces from binary PLY inFile");
+
+    cout << "StreamingTopologySummary {" << endl;
+    PolygonMeshTest::printSummary(summary,"        ",cout);
+    cout << "        nRuns       = " << summary.getNumberOfRuns() << endl;
+    cout << "} StreamingTopologySummary" << endl;
+    return 0;
+  }
+
   //////////////////////////////////////////////////////////////////////
   // create loader and saver factories
   AppLoader loaderFactory;
@@ -142,6 +308,8 @@ int main(int argc, char **argv) {
   loaderFactory.registerLoader(plyLoader);
   LoaderStl* stlLoader = new LoaderStl();
   loaderFactory.registerLoader(stlLoader);
+  stlLoader->setWeldVertices(D._weldVertices);
+  stlLoader->setWeldEpsilon(D._weldEpsilon);
   LoaderWrl* wrlLoader = new LoaderWrl();
   loaderFactory.registerLoader(wrlLoader);
 
@@ -250,10 +418,10 @@ int main(int argc, char **argv) {
   ////////////////////////////////////////////////////////////////////
   // test HalfEdges, PolygonMesh, and PolygonMeshTest
 
-  if(D._debug) {
-    PolygonMeshTest(wrl,"  ");
-    cout << endl;
-  }
+  // - the boundary loops are listed one per line only with -d
+
+  PolygonMeshTest(wrl,"  ",cout,D._debug);
+  if(D._debug) cout << endl;
   
   //////////////////////////////////////////////////////////////////////
   // write
@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// MappedFile.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile():
+  _data(nullptr),
+  _size(0)
+#ifdef _WIN32
+  ,_file(nullptr),
+  _mapping(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+  close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const char* filename) {
+  close();
+  if(filename==nullptr) return false;
+  HANDLE file = CreateFileA(filename,GENERIC_READ,FILE_SHARE_READ,nullptr,
+                            OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,nullptr);
+  if(file==INVALID_HANDLE_VALUE) return false;
+  LARGE_INTEGER size;
+  if(!GetFileSizeEx(file,&size) || size.QuadPart==0) {
+    CloseHandle(file);
+    return false;
+  }
+  HANDLE mapping = CreateFileMappingA(file,nullptr,PAGE_READONLY,0,0,nullptr);
+  void*  data    = (mapping)?MapViewOfFile(mapping,FILE_MAP_READ,0,0,0):nullptr;
+  if(data==nullptr) {
+    if(mapping) CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+  _file    = file;
+  _mapping = mapping;
+  _data    = static_cast<const char*>(data);
+  _size    = static_cast<size_t>(size.QuadPart);
+  return true;
+}
+
+void MappedFile::close() {
+  if(_data)    UnmapViewOfFile(_data);
+  if(_mapping) CloseHandle(static_cast<HANDLE>(_mapping));
+  if(_file)    CloseHandle(static_cast<HANDLE>(_file));
+  _data    = nullptr;
+  _size    = 0;
+  _mapping = nullptr;
+  _file    = nullptr;
+}
+
+#else
+
+bool MappedFile::open(const char* filename) {
+  close();
+  if(filename==nullptr) return false;
+  const int fd = ::open(filename,O_RDONLY);
+  if(fd<0) return false;
+  struct stat st;
+  if(fstat(fd,&st)!=0 || st.st_size<=0) {
+    ::close(fd);
+    return false;
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void* data = mmap(nullptr,size,PROT_READ,MAP_PRIVATE,fd,0);
+  // the mapping remains valid after the file descriptor is closed
+  ::close(fd);
+  if(data==MAP_FAILED) return false;
+  _data = static_cast<const char*>(data);
+  _size = size;
+  return true;
+}
+
+void MappedFile::close() {
+  if(_data)
+    munmap(const_cast<char*>(_data),_size);
+  _data = nullptr;
+  _size = 0;
+}
+
+#endif
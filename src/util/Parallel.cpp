@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// Parallel.cpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static std::atomic<int> _numberOfThreads(1);
+
+void Parallel::setNumberOfThreads(const int n) {
+  _numberOfThreads = (n>0)?n:0;
+}
+
+int Parallel::getNumberOfThreads() {
+  int n = _numberOfThreads;
+  if(n<=0) n = static_cast<int>(std::thread::hardware_concurrency());
+  return (n>0)?n:1;
+}
+
+void Parallel::run(const int nTasks, const std::function<void(int)>& task) {
+  if(nTasks<=0) return;
+  std::vector<std::thread> thread;
+  thread.reserve(nTasks-1);
+  for(int iTask=1;iTask<nTasks;iTask++)
+    thread.emplace_back(task,iTask);
+  task(0);
+  for(std::thread& t : thread)
+    t.join();
+}
+
+int Parallel::getNumberOfChunks(const int64_t n, const int64_t minChunk) {
+  if(n<=0) return 0;
+  const int64_t nChunks = n/std::max<int64_t>(minChunk,1);
+  return static_cast<int>(std::clamp<int64_t>(nChunks,1,getNumberOfThreads()));
+}
+
+void Parallel::forChunks(const int64_t n, const std::function<void(int,int64_t,int64_t)>& fn,
+                         const int64_t minChunk) {
+  const int nChunks = getNumberOfChunks(n,minChunk);
+  run(nChunks,[&](const int iChunk) {
+    const int64_t begin = (n*(iChunk  ))/nChunks;
+    const int64_t end   = (n*(iChunk+1))/nChunks;
+    fn(iChunk,begin,end);
+  });
+}
+
+template<class T>
+void Parallel::radixSort(std::vector<uint64_t>& key, std::vector<T>& value,
+                         const int nBits) {
+  const int     digitBits = 11;
+  const int     nDigits   = 1<<digitBits;
+  const int64_t n         = static_cast<int64_t>(key.size());
+  const int     nChunks   = getNumberOfChunks(n);
+  if(nChunks==0) return;
+  std::vector<uint64_t> key2(n);
+  std::vector<T>        value2(n);
+  // count[iChunk*nDigits+d] holds the number of keys of the chunk with
+  // digit d, and then the position where the first one goes
+  std::vector<int64_t> count(static_cast<size_t>(nChunks)*nDigits);
+  auto chunkBegin = [n,nChunks](int iChunk) {
+    return (n*iChunk)/nChunks;
+  };
+  for(int shift=0;shift<nBits;shift+=digitBits) {
+    std::fill(count.begin(),count.end(),0);
+    run(nChunks,[&](const int iChunk) {
+      int64_t* c = count.data()+static_cast<size_t>(iChunk)*nDigits;
+      for(int64_t i=chunkBegin(iChunk);i<chunkBegin(iChunk+1);i++)
+        c[(key[i]>>shift)&(nDigits-1)]++;
+    });
+    // skip the pass if all the keys have the same digit
+    bool skip = false;
+    for(int d=0;d<nDigits && !skip;d++) {
+      int64_t total = 0;
+      for(int iChunk=0;iChunk<nChunks;iChunk++)
+        total += count[static_cast<size_t>(iChunk)*nDigits+d];
+      if(total==n) skip = true;
+      else if(total>0) break;
+    }
+    if(skip) continue;
+    // digit major, chunk minor exclusive prefix sum keeps the sort
+    // stable
+    int64_t pos = 0;
+    for(int d=0;d<nDigits;d++)
+      for(int iChunk=0;iChunk<nChunks;iChunk++) {
+        int64_t& c = count[static_cast<size_t>(iChunk)*nDigits+d];
+        const int64_t m = c; c = pos; pos += m;
+      }
+    run(nChunks,[&](const int iChunk) {
+      int64_t* c = count.data()+static_cast<size_t>(iChunk)*nDigits;
+      for(int64_t i=chunkBegin(iChunk);i<chunkBegin(iChunk+1);i++) {
+        const int64_t j = c[(key[i]>>shift)&(nDigits-1)]++;
+        key2[j]   = key[i];
+        value2[j] = value[i];
+      }
+    });
+    key.swap(key2);
+    value.swap(value2);
+  }
+}
+
+template void Parallel::radixSort<int>(std::vector<uint64_t>&, std::vector<int>&, int);
+template void Parallel::radixSort<uint32_t>(std::vector<uint64_t>&, std::vector<uint32_t>&, int);
+template void Parallel::radixSort<int64_t>(std::vector<uint64_t>&, std::vector<int64_t>&, int);
@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------
+//  Copyright (C) Gabriel Taubin
+//  Time-stamp: <2026-10-16 10:00:00 taubin>
+//------------------------------------------------------------------------
+//
+// Parallel.hpp
+//
+// Software developed for the course
+// Digital Geometry Processing
+// Copyright (c) 2025, Gabriel Taubin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//     * Redistributions of source code must retain the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials
+//       provided with the distribution.
+//     * Neither the name of the Brown University nor the names of its
+//       contributors may be used to endorse or promote products
+//       derived from this software without specific prior written
+//       permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL GABRIEL
+// TAUBIN BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+// USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Parallel {
+
+  // - number of threads used by the parallel algorithms of the
+  //   library; a value n<=0 selects std::thread::hardware_concurrency()
+  // - the default value is 1, which makes every algorithm run serially
+  //   in the calling thread
+  void setNumberOfThreads(int n);
+  int  getNumberOfThreads();
+
+  // runs task(iTask) for 0<=iTask<nTasks, each one on its own thread;
+  // task 0 runs in the calling thread; returns after all the tasks
+  // have finished
+  void run(int nTasks, const std::function<void(int)>& task);
+
+  // number of chunks used by forChunks(n,fn,minChunk): at most
+  // getNumberOfThreads(), and with at least minChunk elements each
+  int  getNumberOfChunks(int64_t n, int64_t minChunk=(1<<14));
+
+  // splits the range [0,n) into getNumberOfChunks(n,minChunk)
+  // contiguous chunks of almost equal size, and runs fn(iChunk,begin,end)
+  // on each one of them using run()
+  void forChunks(int64_t n, const std::function<void(int,int64_t,int64_t)>& fn,
+                 int64_t minChunk=(1<<14));
+
+  // - stable LSD radix sort of the pairs (key[i],value[i]) by key,
+  //   using 11 bit digits; only the nBits least significant bits of
+  //   the keys are compared, and the other bits must be zero
+  // - each pass builds per-chunk histograms and scatters the chunks
+  //   concurrently
+  // - instantiated for int, uint32_t and int64_t values
+  template<class T>
+  void radixSort(std::vector<uint64_t>& key, std::vector<T>& value, int nBits);
+
+};
+
+#endif // PARALLEL_HPP
@@ -41,8 +41,11 @@ Appearance::Appearance():
   /* _textureTransform;((Node*)0) */
 {}
 
-Appearance::~Appearance()
-{}
+Appearance::~Appearance() {
+  // the material and texture nodes are owned by the appearance
+  if(_material) delete _material;
+  if(_texture) delete _texture;
+}
 
 
 Node* Appearance::getMaterial() {
@@ -120,7 +120,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
       if(coordP==nullptr)
         throw new StrException("  ply does not have vertex coordinates");
       vector<float>* coordV =
-        static_cast<vector<float>*>(coordP->getValue());
+        &coordP->getVector<float>();
       coord.insert(coord.end(),coordV->begin(),coordV->end());
     
       // normals per vertex
@@ -133,7 +133,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
         normal.clear();
         normalIndex.clear();
         vector<float>* normalV =
-          static_cast<vector<float>*>(normalP->getValue());
+          &normalP->getVector<float>();
         normal.insert(normal.end(),normalV->begin(),normalV->end());
 
         // APP->log(QString("%1  nNormals = %2")
@@ -153,7 +153,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
         color.clear();
         colorIndex.clear();
         vector<float>* colorV =
-          static_cast<vector<float>*>(colorP->getValue());
+          &colorP->getVector<float>();
         color.insert(color.end(),colorV->begin(),colorV->end());
 
         // APP->log(QString("%1  nColors = %2")
@@ -173,7 +173,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
         texCoord.clear();
         texCoordIndex.clear();
         vector<float>* texCoordV =
-          static_cast<vector<float>*>(texCoordP->getValue());
+          &texCoordP->getVector<float>();
         texCoord.insert(texCoord.end(),texCoordV->begin(),texCoordV->end());
 
         // APP->log(QString("%1  nTexCoord = %2")
@@ -190,7 +190,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
       
         Ply::Element::Property* coordIndexP = face->getProperty("coordIndex");
         vector<int>* coordIndexV =
-          static_cast<vector<int>*>(coordIndexP->getValue());
+          &coordIndexP->getVector<int>();
         coordIndex.insert(coordIndex.end(),coordIndexV->begin(),coordIndexV->end());
     
         // normals per face
@@ -203,7 +203,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
           normal.clear();
           normalIndex.clear();
           vector<float>* normalV =
-            static_cast<vector<float>*>(normalP->getValue());
+            &normalP->getVector<float>();
           normal.insert(normal.end(),normalV->begin(),normalV->end());
 
           // APP->log(QString("%1  nNormals = %2")
@@ -223,7 +223,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
           color.clear();
           colorIndex.clear();
           vector<float>* colorV =
-            static_cast<vector<float>*>(colorP->getValue());
+            &colorP->getVector<float>();
           color.insert(color.end(),colorV->begin(),colorV->end());
 
           // APP->log(QString("%1  nColors = %2")
@@ -247,13 +247,14 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
 
       // APP->log(QString("%1  has vertex coordinates").arg(indent.c_str()));
 
-      vector<float>* xV = static_cast<vector<float>*>(xP->getValue());
-      vector<float>* yV = static_cast<vector<float>*>(yP->getValue());
-      vector<float>* zV = static_cast<vector<float>*>(zP->getValue());
+      std::span<float> xV = xP->as<float>();
+      std::span<float> yV = yP->as<float>();
+      std::span<float> zV = zP->as<float>();
+      coord.reserve(coord.size()+3*UL(nVertices));
       for(i=0;i<nVertices;i++) {
-        coord.push_back((*xV)[UL(i)]);
-        coord.push_back((*yV)[UL(i)]);
-        coord.push_back((*zV)[UL(i)]);
+        coord.push_back(xV[UL(i)]);
+        coord.push_back(yV[UL(i)]);
+        coord.push_back(zV[UL(i)]);
       }
     
       // normals per vertex
@@ -267,13 +268,14 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
         setNormalPerVertex(true);
         normal.clear();
         normalIndex.clear();
-        vector<float>* nxV = static_cast<vector<float>*>(nxP->getValue());
-        vector<float>* nyV = static_cast<vector<float>*>(nyP->getValue());
-        vector<float>* nzV = static_cast<vector<float>*>(nzP->getValue());
+        std::span<float> nxV = nxP->as<float>();
+        std::span<float> nyV = nyP->as<float>();
+        std::span<float> nzV = nzP->as<float>();
+        normal.reserve(3*UL(nVertices));
         for(i=0;i<nVertices;i++) {
-          normal.push_back((*nxV)[UL(i)]);
-          normal.push_back((*nyV)[UL(i)]);
-          normal.push_back((*nzV)[UL(i)]);
+          normal.push_back(nxV[UL(i)]);
+          normal.push_back(nyV[UL(i)]);
+          normal.push_back(nzV[UL(i)]);
         }
         // APP->log(QString("%1  nNormals = %2")
         //          .arg(indent.c_str()).arg(normal.size()/3));
@@ -293,13 +295,14 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
         setColorPerVertex(true);
         color.clear();
         colorIndex.clear();
-        vector<uchar>* rV = static_cast<vector<uchar>*>(rP->getValue());
-        vector<uchar>* gV = static_cast<vector<uchar>*>(gP->getValue());
-        vector<uchar>* bV = static_cast<vector<uchar>*>(bP->getValue());
+        std::span<uchar> rV = rP->as<uchar>();
+        std::span<uchar> gV = gP->as<uchar>();
+        std::span<uchar> bV = bP->as<uchar>();
+        color.reserve(3*UL(nVertices));
         for(i=0;i<nVertices;i++) {      
-          color.push_back(F((*rV)[UL(i)]&0xff)/255.0f);
-          color.push_back(F((*gV)[UL(i)]&0xff)/255.0f);
-          color.push_back(F((*bV)[UL(i)]&0xff)/255.0f);
+          color.push_back(F(rV[UL(i)]&0xff)/255.0f);
+          color.push_back(F(gV[UL(i)]&0xff)/255.0f);
+          color.push_back(F(bV[UL(i)]&0xff)/255.0f);
         }
         // APP->log(QString("%1  nColors = %2")
         //          .arg(indent.c_str()).arg(color.size()/3));
@@ -317,11 +320,12 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
 
         texCoord.clear();
         texCoordIndex.clear();
-        vector<float>* u = static_cast<vector<float>*>(uP->getValue());
-        vector<float>* v = static_cast<vector<float>*>(vP->getValue());
+        std::span<float> u = uP->as<float>();
+        std::span<float> v = vP->as<float>();
+        texCoord.reserve(2*UL(nVertices));
         for(i=0;i<nVertices;i++) {      
-          texCoord.push_back((*u)[UL(i)]);
-          texCoord.push_back((*v)[UL(i)]);
+          texCoord.push_back(u[UL(i)]);
+          texCoord.push_back(v[UL(i)]);
         }
         // APP->log(QString("%1  nTexCoord = %2")
         //          .arg(indent.c_str()).arg(texCoord.size()/2));
@@ -336,12 +340,13 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
         // APP->log(QString("%1  has faces").arg(indent.c_str()));
       
         Ply::Element::Property* indxP = face->getProperty("vertex_indices");
-        vector<int>*            indxV = static_cast<vector<int>*>(indxP->getValue());
+        std::span<int>          indxV = indxP->as<int>();
+        coordIndex.reserve(coordIndex.size()+indxV.size()+UL(nFaces));
         for(iF=0;iF<nFaces;iF++) {
           i0   = indxP->getListFirst(iF );
           i1   = indxP->getListFirst(iF+1);
           for(i=i0;i<i1;i++)
-            coordIndex.push_back((*indxV)[UL(i)]);
+            coordIndex.push_back(indxV[UL(i)]);
           coordIndex.push_back(-1);
         }
     
@@ -356,13 +361,14 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
           setNormalPerVertex(false);
           normal.clear();
           normalIndex.clear();
-          vector<float>* nxV = static_cast<vector<float>*>(nxP->getValue());
-          vector<float>* nyV = static_cast<vector<float>*>(nyP->getValue());
-          vector<float>* nzV = static_cast<vector<float>*>(nzP->getValue());
+          std::span<float> nxV = nxP->as<float>();
+          std::span<float> nyV = nyP->as<float>();
+          std::span<float> nzV = nzP->as<float>();
+          normal.reserve(3*UL(nFaces));
           for(i=0;i<nFaces;i++) {
-            normal.push_back((*nxV)[UL(i)]);
-            normal.push_back((*nyV)[UL(i)]);
-            normal.push_back((*nzV)[UL(i)]);
+            normal.push_back(nxV[UL(i)]);
+            normal.push_back(nyV[UL(i)]);
+            normal.push_back(nzV[UL(i)]);
           }
           // APP->log(QString("%1  nNormals = %2")
           //          .arg(indent.c_str()).arg(normal.size()/3));
@@ -382,13 +388,14 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
           setColorPerVertex(false);
           color.clear();
           colorIndex.clear();
-          vector<uchar>* rV = static_cast<vector<uchar>*>(rP->getValue());
-          vector<uchar>* gV = static_cast<vector<uchar>*>(gP->getValue());
-          vector<uchar>* bV = static_cast<vector<uchar>*>(bP->getValue());
+          std::span<uchar> rV = rP->as<uchar>();
+          std::span<uchar> gV = gP->as<uchar>();
+          std::span<uchar> bV = bP->as<uchar>();
+          color.reserve(3*UL(nFaces));
           for(i=0;i<nFaces;i++) {      
-            color.push_back(F((*rV)[UL(i)]&0xff)/255.0f);
-            color.push_back(F((*gV)[UL(i)]&0xff)/255.0f);
-            color.push_back(F((*bV)[UL(i)]&0xff)/255.0f);
+            color.push_back(F(rV[UL(i)]&0xff)/255.0f);
+            color.push_back(F(gV[UL(i)]&0xff)/255.0f);
+            color.push_back(F(bV[UL(i)]&0xff)/255.0f);
           }
           // APP->log(QString("%1  nColor = %2")
           //          .arg(indent.c_str()).arg(color.size()/3));
@@ -404,7 +411,7 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
         //            .arg(indent.c_str()));
         //
         //   vector<float>* texCoordV =
-        //     static_cast<vector<float>*>(texCoordP->getValue());
+        //     &texCoordP->getVector<float>();
         //   for(j=iF=0;iF<nFaces;iF++) {
         //     i0   = texCoordP->getListFirst(iF );
         //     i1   = texCoordP->getListFirst(iF+1);
@@ -429,6 +436,8 @@ IndexedFaceSetPly::IndexedFaceSetPly(Ply * ply, const string indent):
   } catch(StrException* e) {
     // APP->log(QString("%1  EXCEPTION | ").arg(indent.c_str()).arg(e->what()));
     delete e;
+  } catch(const std::exception& e) {
+    // APP->log(QString("%1  EXCEPTION | ").arg(indent.c_str()).arg(e.what()));
   }
   
   // APP->log(QString("%1}").arg(indent.c_str()));
@@ -37,6 +37,7 @@
 // USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
+#include <algorithm>
 #include <iostream>
 #include "Ply.hpp"
 #include <io/StrException.hpp>
@@ -351,7 +352,6 @@ void Ply::logInfo(ostream & ostr, const string indent) {
     Ply::Element::Property* property;
     Ply::Element::Property::Type propertyType;
     Ply::Element::Property::Type listType;
-    void* propertyValue;
     int iElement,i0,i1;
     int iProperty,iRecord,nElements,nProperties,nRecords,propertySize;
     string elementName,propertyName;
@@ -437,7 +437,6 @@ void Ply::logInfo(ostream & ostr, const string indent) {
         property      = element->getProperty(iProperty);
         propertyName  = property->getName();
         propertyType  = property->getPropertyType();
-        propertyValue = property->getValue(); 
 
         if(property->isList()==true) {
 
@@ -460,54 +459,7 @@ void Ply::logInfo(ostream & ostr, const string indent) {
 
         } else /* if(property.isList()==false) */ {
 
-          propertySize = 0;
-          switch(propertyType) {
-          case Ply::Element::Property::Type::CHAR:
-          case Ply::Element::Property::Type::INT8:
-            propertySize =
-              I(static_cast<vector<char>*>(propertyValue)->size());
-            break;
-          case Ply::Element::Property::Type::UCHAR:
-          case Ply::Element::Property::Type::UINT8:
-            propertySize =
-              I(static_cast<vector<unsigned char>*>(propertyValue)->size());
-            break;
-          case Ply::Element::Property::Type::SHORT:
-          case Ply::Element::Property::Type::INT16:
-            propertySize =
-              I(static_cast<vector<short>*>(propertyValue)->size());
-            break;
-          case Ply::Element::Property::Type::USHORT:
-          case Ply::Element::Property::Type::UINT16:
-            propertySize =
-              I(static_cast<vector<unsigned short>*>(propertyValue)->size());
-            break;
-          case Ply::Element::Property::Type::INT:
-          case Ply::Element::Property::Type::INT32:
-            propertySize =
-              I(static_cast<vector<int>*>(propertyValue)->size());
-            break;
-          case Ply::Element::Property::Type::UINT:
-          case Ply::Element::Property::Type::UINT32:
-            propertySize =
-              I(static_cast<vector<unsigned int>*>(propertyValue)->size());
-            break;
-          case Ply::Element::Property::Type::FLOAT:
-          case Ply::Element::Property::Type::FLOAT32:
-          case Ply::Element::Property::Type::FLOAT32_2:
-          case Ply::Element::Property::Type::FLOAT32_3:
-            propertySize =
-              I(static_cast<vector<float>*>(propertyValue)->size());
-            break;
-          case Ply::Element::Property::Type::DOUBLE:
-          case Ply::Element::Property::Type::FLOAT64:
-            propertySize =
-              I(static_cast<vector<double>*>(propertyValue)->size());
-            break;
-
-          case Ply::Element::Property::Type::NONE:
-              propertySize = 0;
-          }
+          propertySize = I(property->getNumberOfValues());
 
           ostr << indent
                << "      property[" << iProperty << "] = "
@@ -580,7 +532,7 @@ Ply::Element::addProperty
     typeWrl = Property::Type::FLOAT32_3;
     if((p=getProperty("coord"))==nullptr) {
       p = new Property("coord",false,Property::Type::NONE,typeWrl,*this);
-      _ply._coord = static_cast<vector<float>*>(p->getValue());
+      _ply._coord = &p->getVector<float>();
       _property.push_back(p);
     }
   } else if(wrlMode && _name=="vertex" && list==false &&
@@ -591,7 +543,7 @@ Ply::Element::addProperty
     if((p=getProperty("normal"))==nullptr) {
       p = new Property("normal",false,Property::Type::NONE,typeWrl,*this);
       _ply._normalPerVertex = true;
-      _ply._normal = static_cast<vector<float>*>(p->getValue());
+      _ply._normal = &p->getVector<float>();
       _property.push_back(p);
     }
   } else if(wrlMode && _name=="vertex" && list==false &&
@@ -601,7 +553,7 @@ Ply::Element::addProperty
     if((p=getProperty("color"))==nullptr) {
       p = new Property("color",false,Property::Type::NONE,typeWrl,*this);
       _ply._colorPerVertex = true;
-      _ply._color = static_cast<vector<float>*>(p->getValue());
+      _ply._color = &p->getVector<float>();
       _property.push_back(p);
     }
   } else if(wrlMode && _name=="vertex" && list==false &&
@@ -611,7 +563,7 @@ Ply::Element::addProperty
     typeWrl = Property::Type::FLOAT32_2;
     if((p=getProperty("texCoord"))==nullptr) {
       p = new Property("texCoord",false,Property::Type::NONE,typeWrl,*this);
-      _ply._coord = static_cast<vector<float>*>(p->getValue());
+      _ply._texCoord = &p->getVector<float>();
       _property.push_back(p);
     }
   } else if(wrlMode && _name=="face" && list==false &&
@@ -622,7 +574,7 @@ Ply::Element::addProperty
     if((p=getProperty("normal"))==nullptr) {
       p = new Property("normal",false,Property::Type::NONE,typeWrl,*this);
       _ply._normalPerVertex = false;
-      _ply._normal = static_cast<vector<float>*>(p->getValue());
+      _ply._normal = &p->getVector<float>();
       _property.push_back(p);
     }
   } else if(wrlMode && _name=="face" && list==false &&
@@ -632,14 +584,14 @@ Ply::Element::addProperty
     if((p=getProperty("color"))==nullptr) {
       p = new Property("color",false,Property::Type::NONE,typeWrl,*this);
       _ply._colorPerVertex = false;
-      _ply._color = static_cast<vector<float>*>(p->getValue());
+      _ply._color = &p->getVector<float>();
       _property.push_back(p);
     }
   } else if(wrlMode && _name=="face" && list==true && name=="vertex_indices") {
     typeWrl = Property::Type::INT32;
     if((p=getProperty("coordIndex"))==nullptr) {
       p = new Property("coordIndex",true,listType/*Property::Type::INT*/,typeWrl,*this);
-      _ply._coordIndex = static_cast<vector<int>*>(p->getValue());
+      _ply._coordIndex = &p->getVector<int>();
       _property.push_back(p);
     }
   } else {
@@ -828,7 +780,7 @@ Ply::Element::Property::Property
 (const string& name, const bool list,
  const Type listType, const Type type, Element& element):
   _name(name),
-  _value(nullptr),
+  _values(),
   _first(),
   _type(type),
   _listType(Ply::Element::Property::Type::NONE),
@@ -837,37 +789,37 @@ Ply::Element::Property::Property
   switch(type) {
   case CHAR:
   case INT8:
-    _value = static_cast<void*>(new vector<char>());
+    _values.emplace<vector<char>>();
     break;
   case UCHAR:
   case UINT8:
-    _value = static_cast<void*>(new vector<unsigned char>());
+    _values.emplace<vector<unsigned char>>();
     break;
   case SHORT:
   case INT16:
-    _value = static_cast<void*>(new vector<short>());
+    _values.emplace<vector<short>>();
     break;
   case USHORT:
   case UINT16:
-    _value = static_cast<void*>(new vector<unsigned short>());
+    _values.emplace<vector<unsigned short>>();
     break;
   case INT:
   case INT32:
-    _value = static_cast<void*>(new vector<int>());
+    _values.emplace<vector<int>>();
     break;
   case UINT:
   case UINT32:
-    _value = static_cast<void*>(new vector<unsigned int>());
+    _values.emplace<vector<unsigned int>>();
     break;
   case FLOAT:
   case FLOAT32:
   case FLOAT32_2:
   case FLOAT32_3:
-    _value = static_cast<void*>(new vector<float>());
+    _values.emplace<vector<float>>();
     break;
   case DOUBLE:
   case FLOAT64:
-    _value = static_cast<void*>(new vector<double>());
+    _values.emplace<vector<double>>();
     break;
   case NONE:
     throw new StrException("unexpected Property type");
@@ -880,51 +832,13 @@ Ply::Element::Property::Property
 }
 
 Ply::Element::Property::~Property() {
-  switch(_type) {
-  case CHAR:
-  case INT8:
-    delete static_cast<vector<char>*>(_value);
-    break;
-  case UCHAR:
-  case UINT8:
-    delete static_cast<vector<unsigned char>*>(_value);
-    break;
-  case SHORT:
-  case INT16:
-    delete static_cast<vector<short>*>(_value);
-    break;
-  case USHORT:
-  case UINT16:
-    delete static_cast<vector<unsigned short>*>(_value);
-    break;
-  case INT:
-  case INT32:
-    delete static_cast<vector<int>*>(_value);
-    break;
-  case UINT:
-  case UINT32:
-    delete static_cast<vector<unsigned int>*>(_value);
-    break;
-  case FLOAT:
-  case FLOAT32:
-  case FLOAT32_2:
-  case FLOAT32_3:
-    delete static_cast<vector<float>*>(_value);
-    break;
-  case DOUBLE:
-  case FLOAT64:
-    delete static_cast<vector<double>*>(_value);
-    break;
-  case NONE:
-    break;
-  }
 }
 
 void Ply::Element::Property::swap(Property& p) {
   string name     =     _name; _name     =     p._name; p._name     =      name;
-  void*  value    =    _value; _value    =    p._value; p._value    =     value;
   Type   type     =     _type; _type     =     p._type; p._type     =      type;
   Type   listType = _listType; _listType = p._listType; p._listType =  listType;
+  _values.swap(p._values);
   _first.swap(p._first);
 }
 
@@ -932,7 +846,21 @@ string& Ply::Element::Property::getName() {
   return _name;
 }
 void* Ply::Element::Property::getValue() {
-  return _value;
+  return std::visit([](auto& v) { return static_cast<void*>(&v); },_values);
+}
+size_t Ply::Element::Property::getNumberOfValues() {
+  return std::visit([](auto& v) { return v.size(); },_values);
+}
+void Ply::Element::Property::reserve(const size_t nValues, const size_t nLists) {
+  std::visit([nValues](auto& v) { v.reserve(nValues); },_values);
+  if(isList()) _first.reserve(nLists+1);
+}
+void Ply::Element::Property::resize(const size_t nValues) {
+  std::visit([nValues](auto& v) { v.resize(nValues); },_values);
+}
+void Ply::Element::Property::clear(const bool release) {
+  std::visit([release](auto& v) { v.clear(); if(release) v.shrink_to_fit(); },_values);
+  if(isList()) _first.resize(1);
 }
 bool Ply::Element::Property::isList() {
   return (_first.size()>0);
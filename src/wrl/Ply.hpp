@@ -42,7 +42,10 @@
 #ifndef  PLY_HPP
 #define  PLY_HPP
 
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <variant>
 #include <vector>
 
 using namespace std;
@@ -92,6 +95,16 @@ public:
         FLOAT32_2, FLOAT32_3
       };
 
+      // the values of a property are stored in a vector of the C++
+      // type of the property type: char, unsigned char, short,
+      // unsigned short, int, unsigned int, float, or double; the
+      // FLOAT32_2 and FLOAT32_3 types of wrlMode store 2 and 3 float
+      // values per record
+      using Values = std::variant<vector<char>,vector<unsigned char>,
+                                  vector<short>,vector<unsigned short>,
+                                  vector<int>,vector<unsigned int>,
+                                  vector<float>,vector<double>>;
+
       static Type         parseType(const string& token);
       static const string getTypeName(const Type type);
       static int          getTypeSize(const Type type);
@@ -103,6 +116,19 @@ public:
       void             swap(Property& p);
       string&          getName();
       void*            getValue();
+      // - typed access to the values; T must be the C++ type of the
+      //   property type, otherwise a runtime_error is thrown
+      template<class T>
+      vector<T>&       getVector();
+      template<class T>
+      std::span<T>     as() { return std::span<T>(getVector<T>()); }
+      size_t           getNumberOfValues();
+      // - nLists is the number of list records to reserve offsets for
+      void             reserve(const size_t nValues, const size_t nLists=0);
+      void             resize(const size_t nValues);
+      // - removes all the values, and the list offsets; if release is
+      //   true, the memory of the values is freed as well
+      void             clear(const bool release=false);
       bool             isList();
       Type             getListType();
       const string     getListTypeName();
@@ -117,7 +143,7 @@ public:
     private:
 
       string          _name;
-      void*           _value;
+      Values          _values;
       vector<int>     _first;
       Type            _type;
       Type            _listType;
@@ -235,4 +261,12 @@ private:
 
 };
 
+template<class T>
+vector<T>& Ply::Element::Property::getVector() {
+  vector<T>* v = std::get_if<vector<T>>(&_values);
+  if(v==nullptr)
+    throw std::runtime_error("unexpected value type for property "+_name);
+  return *v;
+}
+
 #endif // PLY_HPP
@@ -33,7 +33,12 @@
 // SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <math.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <core/ConcurrentPartition.hpp>
+#include <util/Parallel.hpp>
 #include "SceneGraphProcessor.hpp"
 #include "SceneGraphTraversal.hpp"
 #include "Shape.hpp"
@@ -334,6 +339,527 @@ void SceneGraphProcessor::_computeNormalPerCorner(IndexedFaceSet& ifs) {
   }
 }
 
+//////////////////////////////////////////////////////////////////////
+// reordering
+
+void SceneGraphProcessor::reorderVerticesMorton() {
+  _applyToIndexedFaceSet(_reorderVerticesMorton);
+}
+
+void SceneGraphProcessor::reorderVerticesHilbert() {
+  _applyToIndexedFaceSet(_reorderVerticesHilbert);
+}
+
+void SceneGraphProcessor::reorderFacesHilbert() {
+  _applyToIndexedFaceSet(_reorderFacesHilbert);
+}
+
+void SceneGraphProcessor::reorderFacesVertexCache() {
+  _applyToIndexedFaceSet(_reorderFacesVertexCache);
+}
+
+namespace {
+
+  // number of bits per coordinate of the space filling curve keys
+  const int curveBits = 21;
+
+  // spreads the 21 low bits of x so that there are two zero bits
+  // between consecutive ones
+  uint64_t spreadBits(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x|(x<<32))&0x001f00000000ffffULL;
+    x = (x|(x<<16))&0x001f0000ff0000ffULL;
+    x = (x|(x<< 8))&0x100f00f00f00f00fULL;
+    x = (x|(x<< 4))&0x10c30c30c30c30c3ULL;
+    x = (x|(x<< 2))&0x1249249249249249ULL;
+    return x;
+  }
+
+  uint64_t mortonKey(const uint32_t x[3]) {
+    return (spreadBits(x[0])<<2)|(spreadBits(x[1])<<1)|spreadBits(x[2]);
+  }
+
+  // - Hilbert curve key of a point with integer coordinates, using
+  //   Skilling's transform to the transposed Hilbert index, which is
+  //   then interleaved as a Morton key
+  // - J. Skilling, "Programming the Hilbert curve", AIP Conference
+  //   Proceedings 707, 2004
+  uint64_t hilbertKey(const uint32_t p[3]) {
+    uint32_t x[3] = { p[0], p[1], p[2] };
+    const uint32_t M = 1u<<(curveBits-1);
+    for(uint32_t Q=M;Q>1;Q>>=1) {
+      const uint32_t P = Q-1;
+      for(int i=0;i<3;i++) {
+        if(x[i]&Q) {
+          x[0] ^= P;
+        } else {
+          const uint32_t t = (x[0]^x[i])&P;
+          x[0] ^= t; x[i] ^= t;
+        }
+      }
+    }
+    x[1] ^= x[0];
+    x[2] ^= x[1];
+    uint32_t t = 0;
+    for(uint32_t Q=M;Q>1;Q>>=1)
+      if(x[2]&Q) t ^= Q-1;
+    for(int i=0;i<3;i++)
+      x[i] ^= t;
+    return mortonKey(x);
+  }
+
+  // quantizes points to curveBits bits per coordinate within the
+  // bounding box of the points
+  class CurveQuantizer {
+  public:
+    CurveQuantizer(const vector<float>& point) {
+      const size_t n = point.size()/3;
+      for(int j=0;j<3;j++) { _min[j] = 0.0f; _scale[j] = 0.0f; }
+      if(n==0) return;
+      float max[3];
+      for(int j=0;j<3;j++) _min[j] = max[j] = point[j];
+      for(size_t i=1;i<n;i++)
+        for(int j=0;j<3;j++) {
+          _min[j] = std::min(_min[j],point[3*i+j]);
+          max[j]  = std::max(max[j], point[3*i+j]);
+        }
+      const float maxCell = static_cast<float>((1<<curveBits)-1);
+      for(int j=0;j<3;j++)
+        _scale[j] = (max[j]>_min[j])?maxCell/(max[j]-_min[j]):0.0f;
+    }
+    void quantize(const float* x, uint32_t q[3]) const {
+      const float maxCell = static_cast<float>((1<<curveBits)-1);
+      for(int j=0;j<3;j++)
+        q[j] = static_cast<uint32_t>(std::clamp((x[j]-_min[j])*_scale[j],0.0f,maxCell));
+    }
+  private:
+    float _min[3];
+    float _scale[3];
+  };
+
+  // returns the order of the points sorted by their curve keys; the
+  // sort is stable, so points in the same cell keep their order
+  vector<int> curveOrder(const vector<float>& point,
+                         uint64_t (*curveKey)(const uint32_t[3])) {
+    const int n = static_cast<int>(point.size()/3);
+    const CurveQuantizer quantizer(point);
+    vector<uint64_t> key(n);
+    vector<int>      order(n);
+    Parallel::forChunks(n,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+      uint32_t q[3];
+      for(int64_t i=begin;i<end;i++) {
+        quantizer.quantize(&point[3*i],q);
+        key[i]   = curveKey(q);
+        order[i] = static_cast<int>(i);
+      }
+    });
+    Parallel::radixSort(key,order,3*curveBits);
+    return order;
+  }
+
+  // faceFirst[iF] is the first corner of face iF, and
+  // faceFirst[nF]-1 the separator of the last face
+  vector<int> faceOffsets(const vector<int>& coordIndex) {
+    vector<int> faceFirst(1,0);
+    const int nC = static_cast<int>(coordIndex.size());
+    for(int iC=0;iC<nC;iC++)
+      if(coordIndex[iC]<0) faceFirst.push_back(iC+1);
+    return faceFirst;
+  }
+
+  // permutes the groups of size values of an array with one group
+  // per element
+  void permuteGroups(vector<float>& value, const vector<int>& order, const int size) {
+    const size_t n = order.size();
+    if(value.size()<n*size) return;
+    vector<float> permuted(value.size());
+    for(size_t i=0;i<n;i++)
+      for(int j=0;j<size;j++)
+        permuted[i*size+j] = value[order[i]*size+j];
+    std::copy(value.begin()+n*size,value.end(),permuted.begin()+n*size);
+    value.swap(permuted);
+  }
+
+  // permutes the faces of an array with the face structure of
+  // coordIndex; the values after the last separator stay at the end
+  void permuteCorners(vector<int>& index, const vector<int>& faceFirst,
+                      const vector<int>& order) {
+    if(index.size()<static_cast<size_t>(faceFirst.back())) return;
+    vector<int> permuted;
+    permuted.reserve(index.size());
+    for(const int iF : order)
+      permuted.insert(permuted.end(),index.begin()+faceFirst[iF],index.begin()+faceFirst[iF+1]);
+    permuted.insert(permuted.end(),index.begin()+faceFirst.back(),index.end());
+    index.swap(permuted);
+  }
+
+  void permuteFaceIndex(vector<int>& index, const vector<int>& order) {
+    if(index.size()<order.size()) return;
+    vector<int> permuted(index);
+    for(size_t i=0;i<order.size();i++)
+      permuted[i] = index[order[i]];
+    index.swap(permuted);
+  }
+
+}
+
+void SceneGraphProcessor::_permuteVertices
+(IndexedFaceSet& ifs, const vector<int>& vertexOrder) {
+  const int nV = static_cast<int>(vertexOrder.size());
+  vector<int> newIndex(nV);
+  for(int iV=0;iV<nV;iV++)
+    newIndex[vertexOrder[iV]] = iV;
+
+  // the bindings are evaluated before any array is modified
+  const bool normalPerVertex   = ifs.getNormalBinding()  ==IndexedFaceSet::PB_PER_VERTEX;
+  const bool colorPerVertex    = ifs.getColorBinding()   ==IndexedFaceSet::PB_PER_VERTEX;
+  const bool texCoordPerVertex = ifs.getTexCoordBinding()==IndexedFaceSet::PB_PER_VERTEX;
+
+  permuteGroups(ifs.getCoord(),vertexOrder,3);
+  for(int& iV : ifs.getCoordIndex())
+    if(iV>=0 && iV<nV) iV = newIndex[iV];
+  if(normalPerVertex)   permuteGroups(ifs.getNormal(),  vertexOrder,3);
+  if(colorPerVertex)    permuteGroups(ifs.getColor(),   vertexOrder,3);
+  if(texCoordPerVertex) permuteGroups(ifs.getTexCoord(),vertexOrder,2);
+}
+
+void SceneGraphProcessor::_permuteFaces
+(IndexedFaceSet& ifs, const vector<int>& faceOrder) {
+  const vector<int> faceFirst = faceOffsets(ifs.getCoordIndex());
+
+  const IndexedFaceSet::Binding normalBinding   = ifs.getNormalBinding();
+  const IndexedFaceSet::Binding colorBinding    = ifs.getColorBinding();
+  const IndexedFaceSet::Binding texCoordBinding = ifs.getTexCoordBinding();
+
+  permuteCorners(ifs.getCoordIndex(),faceFirst,faceOrder);
+
+  if(normalBinding==IndexedFaceSet::PB_PER_CORNER)
+    permuteCorners(ifs.getNormalIndex(),faceFirst,faceOrder);
+  else if(normalBinding==IndexedFaceSet::PB_PER_FACE_INDEXED)
+    permuteFaceIndex(ifs.getNormalIndex(),faceOrder);
+  else if(normalBinding==IndexedFaceSet::PB_PER_FACE)
+    permuteGroups(ifs.getNormal(),faceOrder,3);
+
+  if(colorBinding==IndexedFaceSet::PB_PER_CORNER)
+    permuteCorners(ifs.getColorIndex(),faceFirst,faceOrder);
+  else if(colorBinding==IndexedFaceSet::PB_PER_FACE_INDEXED)
+    permuteFaceIndex(ifs.getColorIndex(),faceOrder);
+  else if(colorBinding==IndexedFaceSet::PB_PER_FACE)
+    permuteGroups(ifs.getColor(),faceOrder,3);
+
+  if(texCoordBinding==IndexedFaceSet::PB_PER_CORNER)
+    permuteCorners(ifs.getTexCoordIndex(),faceFirst,faceOrder);
+}
+
+void SceneGraphProcessor::_reorderVerticesMorton(IndexedFaceSet& ifs) {
+  _permuteVertices(ifs,curveOrder(ifs.getCoord(),mortonKey));
+}
+
+void SceneGraphProcessor::_reorderVerticesHilbert(IndexedFaceSet& ifs) {
+  _permuteVertices(ifs,curveOrder(ifs.getCoord(),hilbertKey));
+}
+
+void SceneGraphProcessor::_reorderFacesHilbert(IndexedFaceSet& ifs) {
+  const vector<float>& coord      = ifs.getCoord();
+  const vector<int>&   coordIndex = ifs.getCoordIndex();
+  const vector<int>    faceFirst  = faceOffsets(coordIndex);
+  const int nF = static_cast<int>(faceFirst.size())-1;
+  const int nV = static_cast<int>(coord.size()/3);
+  vector<float> centroid(3*nF,0.0f);
+  for(int iF=0;iF<nF;iF++) {
+    int n = 0;
+    for(int iC=faceFirst[iF];iC<faceFirst[iF+1]-1;iC++) {
+      const int iV = coordIndex[iC];
+      if(iV<0 || iV>=nV) continue;
+      for(int j=0;j<3;j++) centroid[3*iF+j] += coord[3*iV+j];
+      n++;
+    }
+    if(n>0)
+      for(int j=0;j<3;j++) centroid[3*iF+j] /= static_cast<float>(n);
+  }
+  _permuteFaces(ifs,curveOrder(centroid,hilbertKey));
+}
+
+// - T. Forsyth, "Linear-Speed Vertex Cache Optimisation", 2006
+// - faces are emitted greedily; the score of a face is the sum of the
+//   scores of its vertices, which favor the vertices recently used,
+//   and the vertices with few faces left to emit
+// - the next face is the best scoring face incident to the vertices
+//   in the cache; if there is none the first face not yet emitted is
+//   taken, so the cost is linear in the number of corners times the
+//   size of the cache
+void SceneGraphProcessor::_reorderFacesVertexCache(IndexedFaceSet& ifs) {
+  const int   cacheSize         = 32;
+  const float cacheDecayPower   = 1.5f;
+  const float lastFaceScore     = 0.75f;
+  const float valenceBoostScale = 2.0f;
+  const float valenceBoostPower = 0.5f;
+
+  const vector<int>& coordIndex = ifs.getCoordIndex();
+  const vector<int>  faceFirst  = faceOffsets(coordIndex);
+  const int nF = static_cast<int>(faceFirst.size())-1;
+  const int nV = static_cast<int>(ifs.getCoord().size()/3);
+  if(nF<2) return;
+
+  auto isVertex = [nV](const int iV) { return iV>=0 && iV<nV; };
+
+  // faces incident to each vertex; the first vertexFaceCount[iV]
+  // ones of the list of iV are the faces not emitted yet
+  vector<int> vertexFaceFirst(nV+1,0);
+  for(int iF=0;iF<nF;iF++)
+    for(int iC=faceFirst[iF];iC<faceFirst[iF+1]-1;iC++)
+      if(isVertex(coordIndex[iC])) vertexFaceFirst[coordIndex[iC]+1]++;
+  for(int iV=0;iV<nV;iV++)
+    vertexFaceFirst[iV+1] += vertexFaceFirst[iV];
+  vector<int> vertexFace(vertexFaceFirst[nV]);
+  vector<int> vertexFaceCount(nV,0);
+  for(int iF=0;iF<nF;iF++)
+    for(int iC=faceFirst[iF];iC<faceFirst[iF+1]-1;iC++) {
+      const int iV = coordIndex[iC];
+      if(isVertex(iV))
+        vertexFace[vertexFaceFirst[iV]+vertexFaceCount[iV]++] = iF;
+    }
+
+  vector<int>   cachePosition(nV,-1);
+  vector<float> vertexScore(nV,0.0f);
+  auto score = [&](const int iV) {
+    const int nFV = vertexFaceCount[iV];
+    if(nFV==0) return -1.0f;
+    float s = 0.0f;
+    const int p = cachePosition[iV];
+    if(p>=0) {
+      if(p<3) {
+        s = lastFaceScore;
+      } else {
+        const float scale = 1.0f/static_cast<float>(cacheSize-3);
+        s = powf(1.0f-static_cast<float>(p-3)*scale,cacheDecayPower);
+      }
+    }
+    return s+valenceBoostScale*powf(static_cast<float>(nFV),-valenceBoostPower);
+  };
+  for(int iV=0;iV<nV;iV++)
+    vertexScore[iV] = score(iV);
+
+  vector<float> faceScore(nF,0.0f);
+  for(int iF=0;iF<nF;iF++)
+    for(int iC=faceFirst[iF];iC<faceFirst[iF+1]-1;iC++)
+      if(isVertex(coordIndex[iC])) faceScore[iF] += vertexScore[coordIndex[iC]];
+
+  vector<char> emitted(nF,0);
+  vector<int>  faceOrder;
+  faceOrder.reserve(nF);
+  vector<int>  cache, newCache;
+  int nextFace = 0;
+  int bestFace = 0;
+  while(static_cast<int>(faceOrder.size())<nF) {
+    if(bestFace<0) {
+      while(emitted[nextFace]) nextFace++;
+      bestFace = nextFace;
+    }
+    const int iF = bestFace;
+    emitted[iF] = 1;
+    faceOrder.push_back(iF);
+
+    // remove the face from the lists of its vertices, and move the
+    // vertices to the front of the cache
+    newCache.clear();
+    for(int iC=faceFirst[iF];iC<faceFirst[iF+1]-1;iC++) {
+      const int iV = coordIndex[iC];
+      if(!isVertex(iV)) continue;
+      int* face = &vertexFace[vertexFaceFirst[iV]];
+      int& n    = vertexFaceCount[iV];
+      for(int j=0;j<n;j++)
+        if(face[j]==iF) { face[j] = face[--n]; break; }
+      if(std::find(newCache.begin(),newCache.end(),iV)==newCache.end())
+        newCache.push_back(iV);
+    }
+    for(const int iV : cache)
+      if(std::find(newCache.begin(),newCache.end(),iV)==newCache.end())
+        newCache.push_back(iV);
+
+    // update the scores of the vertices in the old and new cache, and
+    // of their faces not emitted yet
+    for(const int iV : cache) cachePosition[iV] = -1;
+    const int nCache = std::min(static_cast<int>(newCache.size()),cacheSize);
+    for(int p=0;p<nCache;p++) cachePosition[newCache[p]] = p;
+    bestFace = -1;
+    float bestScore = -1.0f;
+    for(const int iV : newCache) {
+      const float s = score(iV);
+      const float ds = s-vertexScore[iV];
+      vertexScore[iV] = s;
+      const int* face = &vertexFace[vertexFaceFirst[iV]];
+      for(int j=0;j<vertexFaceCount[iV];j++) {
+        faceScore[face[j]] += ds;
+        if(faceScore[face[j]]>bestScore) {
+          bestScore = faceScore[face[j]];
+          bestFace  = face[j];
+        }
+      }
+    }
+    newCache.resize(nCache);
+    cache.swap(newCache);
+  }
+  _permuteFaces(ifs,faceOrder);
+}
+
+//////////////////////////////////////////////////////////////////////
+// welding
+
+void SceneGraphProcessor::weldVertices(const float epsilon) {
+  SceneGraphTraversal traversal(_wrl);
+  traversal.start();
+  Node* node;
+  while((node=traversal.next())!=(Node*)0) {
+    if(node->isShape()) {
+      Shape* shape = (Shape*)node;
+      node = shape->getGeometry();
+      if(node!=(Node*)0 && node->isIndexedFaceSet())
+        weldVertices(*((IndexedFaceSet*)node),epsilon);
+    }
+  }
+}
+
+namespace {
+
+  uint64_t mixBits(uint64_t x) {
+    // splitmix64 finalizer
+    x ^= x>>30; x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x>>27; x *= 0x94d049bb133111ebULL;
+    x ^= x>>31;
+    return x;
+  }
+
+  uint64_t hashCell(const int64_t c[3]) {
+    uint64_t h = mixBits(static_cast<uint64_t>(c[0]));
+    h = mixBits(h^static_cast<uint64_t>(c[1]));
+    h = mixBits(h^static_cast<uint64_t>(c[2]));
+    return h;
+  }
+
+  // bit pattern of x, with -0 mapped to 0
+  uint32_t floatBits(const float x) {
+    uint32_t b;
+    const float y = (x==0.0f)?0.0f:x;
+    memcpy(&b,&y,sizeof(b));
+    return b;
+  }
+
+  // reduces the groups of size values of an array with one group per
+  // element to the groups of the elements in rep
+  void gatherGroups(vector<float>& value, const vector<int>& rep, const int size) {
+    vector<float> gathered(rep.size()*size);
+    for(size_t i=0;i<rep.size();i++)
+      for(int j=0;j<size;j++)
+        gathered[i*size+j] = value[static_cast<size_t>(rep[i])*size+j];
+    value.swap(gathered);
+  }
+
+}
+
+int SceneGraphProcessor::weldVertices(IndexedFaceSet& ifs, const float epsilon) {
+  vector<float>& coord = ifs.getCoord();
+  const int nV = static_cast<int>(coord.size()/3);
+  if(nV<2) return 0;
+  const bool exact = !(epsilon>0.0f);
+
+  // 1) hash every vertex, by the bit patterns of its coordinates or by
+  //    its grid cell, and sort the vertices by hash
+  float min[3] = { coord[0], coord[1], coord[2] };
+  for(int iV=1;iV<nV;iV++)
+    for(int j=0;j<3;j++) min[j] = std::min(min[j],coord[3*iV+j]);
+  auto cellOf = [&](const int iV, int64_t c[3]) {
+    for(int j=0;j<3;j++)
+      c[j] = static_cast<int64_t>(floor((coord[3*iV+j]-min[j])/epsilon));
+  };
+  vector<uint64_t> key(nV);
+  vector<int>      order(nV);
+  Parallel::forChunks(nV,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    int64_t c[3];
+    for(int64_t i=begin;i<end;i++) {
+      const int iV = static_cast<int>(i);
+      if(exact) {
+        for(int j=0;j<3;j++) c[j] = floatBits(coord[3*iV+j]);
+      } else {
+        cellOf(iV,c);
+      }
+      key[iV]   = hashCell(c);
+      order[iV] = iV;
+    }
+  });
+  vector<uint64_t> sortedKey(key);
+  Parallel::radixSort(sortedKey,order,64);
+
+  // 2) join each vertex with the matching vertices of the same hash,
+  //    or of the hashes of the 27 cells around its own; hash
+  //    collisions only cost extra comparisons
+  auto sameCoord = [&](const int iV0, const int iV1) {
+    for(int j=0;j<3;j++)
+      if(floatBits(coord[3*iV0+j])!=floatBits(coord[3*iV1+j])) return false;
+    return true;
+  };
+  const float epsilon2 = epsilon*epsilon;
+  auto near = [&](const int iV0, const int iV1) {
+    float d2 = 0.0f;
+    for(int j=0;j<3;j++) {
+      const float d = coord[3*iV0+j]-coord[3*iV1+j];
+      d2 += d*d;
+    }
+    return d2<=epsilon2;
+  };
+  ConcurrentPartition partition(nV);
+  Parallel::forChunks(nV,[&](int /*iChunk*/, int64_t begin, int64_t end) {
+    int64_t c[3], cn[3];
+    for(int64_t i=begin;i<end;i++) {
+      const int iV = static_cast<int>(i);
+      if(exact) {
+        // the first vertex of the hash with the same coordinates
+        auto range = std::equal_range(sortedKey.begin(),sortedKey.end(),key[iV]);
+        for(auto k=range.first;k!=range.second;k++) {
+          const int jV = order[k-sortedKey.begin()];
+          if(sameCoord(iV,jV)) {
+            if(jV!=iV) partition.join(iV,jV);
+            break;
+          }
+        }
+        continue;
+      }
+      cellOf(iV,c);
+      for(int dx=-1;dx<=1;dx++)
+        for(int dy=-1;dy<=1;dy++)
+          for(int dz=-1;dz<=1;dz++) {
+            cn[0] = c[0]+dx; cn[1] = c[1]+dy; cn[2] = c[2]+dz;
+            auto range = std::equal_range(sortedKey.begin(),sortedKey.end(),hashCell(cn));
+            for(auto k=range.first;k!=range.second;k++) {
+              const int jV = order[k-sortedKey.begin()];
+              if(jV>iV && near(iV,jV)) partition.join(iV,jV);
+            }
+          }
+    }
+  });
+  const int nVnew = partition.getNumberOfParts();
+  if(nVnew==nV) return 0;
+
+  // 3) the parts are labeled in increasing order of their smallest
+  //    vertex, which represents them
+  const vector<int> label = partition.compactLabels();
+  vector<int> rep(nVnew,-1);
+  for(int iV=0;iV<nV;iV++)
+    if(rep[label[iV]]<0) rep[label[iV]] = iV;
+
+  const bool normalPerVertex   = ifs.getNormalBinding()  ==IndexedFaceSet::PB_PER_VERTEX;
+  const bool colorPerVertex    = ifs.getColorBinding()   ==IndexedFaceSet::PB_PER_VERTEX;
+  const bool texCoordPerVertex = ifs.getTexCoordBinding()==IndexedFaceSet::PB_PER_VERTEX;
+
+  gatherGroups(coord,rep,3);
+  for(int& iV : ifs.getCoordIndex())
+    if(iV>=0 && iV<nV) iV = label[iV];
+  if(normalPerVertex)   gatherGroups(ifs.getNormal(),  rep,3);
+  if(colorPerVertex)    gatherGroups(ifs.getColor(),   rep,3);
+  if(texCoordPerVertex) gatherGroups(ifs.getTexCoord(),rep,2);
+  return nV-nVnew;
+}
+
 void SceneGraphProcessor::bboxAdd
 (int depth, float scale, bool isCube) {
   const string name = "BOUNDING-BOX";
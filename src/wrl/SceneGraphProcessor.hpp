@@ -54,6 +54,38 @@ public:
   void computeNormalPerVertex();
   void computeNormalPerCorner();
 
+  // - reorder the vertices of every IndexedFaceSet along a Morton
+  //   (Z-order) or a Hilbert curve through their bounding box, and
+  //   the faces along a Hilbert curve through their centroids, so
+  //   that elements close in space are also close in memory
+  // - reorderFacesVertexCache() orders the faces for a vertex cache
+  //   of 32 entries, following Forsyth's greedy heuristic
+  // - coordIndex, and the per-vertex, per-face, and per-corner
+  //   properties are remapped consistently; the geometry and the
+  //   orientation of the faces do not change
+  void reorderVerticesMorton();
+  void reorderVerticesHilbert();
+  void reorderFacesHilbert();
+  void reorderFacesVertexCache();
+
+  // - merges the vertices of every IndexedFaceSet which have the same
+  //   coordinates, or, if epsilon>0, which are joined by a chain of
+  //   vertices at distance at most epsilon from each other; each
+  //   group of merged vertices keeps the coordinates and the per-vertex
+  //   properties of its vertex of smallest index, and the remaining
+  //   vertices keep their relative order
+  // - coordIndex is remapped, and the faces and their per-face and
+  //   per-corner properties are not modified; with epsilon>0 some
+  //   faces may end up with repeated vertices
+  // - both modes run in parallel on Parallel::getNumberOfThreads()
+  //   threads: the exact mode hashes the bit patterns of the
+  //   coordinates, where 0 and -0 are equal, and the epsilon mode
+  //   hashes the vertices into a grid of cells of size epsilon, and
+  //   only compares the vertices in neighboring cells
+  // - weldVertices(ifs,epsilon) returns the number of vertices removed
+  void weldVertices(float epsilon=0.0f);
+  static int weldVertices(IndexedFaceSet& ifs, float epsilon=0.0f);
+
   void bboxAdd(int depth=0, float scale=1.0f, bool isCube=true);
   void bboxRemove();
   bool hasBBox();
@@ -100,6 +132,15 @@ private:
   static void _computeNormalPerVertex(IndexedFaceSet& ifs);
   static void _computeNormalPerCorner(IndexedFaceSet& ifs);
 
+  static void _reorderVerticesMorton(IndexedFaceSet& ifs);
+  static void _reorderVerticesHilbert(IndexedFaceSet& ifs);
+  static void _reorderFacesHilbert(IndexedFaceSet& ifs);
+  static void _reorderFacesVertexCache(IndexedFaceSet& ifs);
+
+  // vertexOrder[iVnew]==iVold, and faceOrder[iFnew]==iFold
+  static void _permuteVertices(IndexedFaceSet& ifs, const vector<int>& vertexOrder);
+  static void _permuteFaces(IndexedFaceSet& ifs, const vector<int>& faceOrder);
+
   static void _computeFaceNormal
               (vector<float>& coord, vector<int>&   coordIndex,
                int i0, int i1, Vec3f& n, bool normalize);
@@ -42,6 +42,9 @@ Shape::Shape():
 }
 
 Shape::~Shape() {
+  // the appearance and geometry nodes are owned by the shape
+  if(_appearance) delete _appearance;
+  if(_geometry) delete _geometry;
 }
 
 Node* Shape::getAppearance() {